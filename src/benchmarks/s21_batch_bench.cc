@@ -0,0 +1,63 @@
+#include <string>
+#include <vector>
+
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+// Random lookups, half of them misses, asked one at a time and then handed
+// to contains_batch/find_batch in batches of growing size, which is how a
+// join or a batched request would call them.
+void RunBatches(const s21::set<int> &set, const std::vector<int> &probes) {
+  long hits = 0;
+  double seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += set.contains(key);
+  });
+  s21_bench::Report("contains", probes.size(), seconds);
+
+  std::vector<char> present(probes.size());
+  std::vector<s21::set<int>::iterator> found(probes.size(), set.end());
+  for (std::size_t batch : {8, 16, 32, 64, 128, 256}) {
+    std::size_t whole = probes.size() / batch * batch;
+    seconds = s21_bench::SecondsOf([&] {
+      for (std::size_t i = 0; i < whole; i += batch)
+        set.contains_batch(probes.begin() + i, probes.begin() + i + batch,
+                           present.begin() + i);
+    });
+    std::string name = "contains_batch, batch " + std::to_string(batch);
+    s21_bench::Report(name.c_str(), whole, seconds);
+
+    seconds = s21_bench::SecondsOf([&] {
+      for (std::size_t i = 0; i < whole; i += batch)
+        set.find_batch(probes.begin() + i, probes.begin() + i + batch,
+                       found.begin() + i);
+    });
+    name = "find_batch, batch " + std::to_string(batch);
+    s21_bench::Report(name.c_str(), whole, seconds);
+  }
+
+  for (char hit : present) hits += hit;
+  s21_bench::DoNotOptimize(hits);
+  s21_bench::DoNotOptimize(found.front());
+}
+
+void Run(std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  std::vector<int> probes = s21_bench::ShuffledKeys(2 * count, 43);
+  probes.resize(std::max<std::size_t>(count, 1000000));
+  for (std::size_t i = 2 * count; i < probes.size(); ++i)
+    probes[i] = probes[i % (2 * count)];
+
+  s21::set<int> set;
+  for (int key : keys) set.insert(key);
+  RunBatches(set, probes);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 10000, 100000, 1000000, 10000000}) {
+    std::printf("n = %zu\n", count);
+    Run(count);
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BENCH_H
+#define CPP2_S21_CONTAINERS_1_S21_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <unistd.h>
+
+namespace s21_bench {
+// Keeps the optimizer from dropping the work whose result is passed in.
+template <typename T>
+inline void DoNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename F>
+double SecondsOf(F &&work) {
+  auto start = std::chrono::steady_clock::now();
+  work();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+inline std::vector<int> ShuffledKeys(std::size_t count, std::uint32_t seed) {
+  std::vector<int> keys(count);
+  for (std::size_t i = 0; i < count; ++i) keys[i] = static_cast<int>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+  return keys;
+}
+
+// Current resident set size, or 0 where /proc is not available.
+inline std::size_t ResidentBytes() {
+  std::size_t pages = 0, resident = 0;
+  std::FILE *statm = std::fopen("/proc/self/statm", "r");
+  if (!statm) return 0;
+  if (std::fscanf(statm, "%zu %zu", &pages, &resident) != 2) resident = 0;
+  std::fclose(statm);
+  return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+inline void Report(const char *name, std::size_t ops, double seconds) {
+  std::printf("%-40s %12.1f ns/op %14.0f ops/s\n", name, seconds * 1e9 / ops,
+              ops / seconds);
+}
+}  // namespace s21_bench
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BENCH_H
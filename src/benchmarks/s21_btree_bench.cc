@@ -0,0 +1,84 @@
+#include <sys/wait.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_containers/s21_btree_map.h"
+#include "../s21_containers/s21_btree_set.h"
+#include "../s21_containers/s21_map.h"
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+int KeyOf(int value) { return value; }
+int KeyOf(const std::pair<const int, int> &value) { return value.first; }
+
+template <typename Container>
+void Insert(Container &container, int key) {
+  if constexpr (std::is_same<typename Container::key_type,
+                             typename Container::value_type>::value)
+    container.insert(key);
+  else
+    container.insert({key, key});
+}
+
+// Inserts count shuffled keys, looks each of them up in another order,
+// scans the whole container and reports the memory it holds per element.
+template <typename Container>
+void Run(const std::string &name, std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  std::vector<int> probes = s21_bench::ShuffledKeys(count, 43);
+  std::size_t resident_before = s21_bench::ResidentBytes();
+  Container container;
+
+  double seconds = s21_bench::SecondsOf([&] {
+    for (int key : keys) Insert(container, key);
+  });
+  std::size_t resident = s21_bench::ResidentBytes() - resident_before;
+  s21_bench::Report((name + " insert").c_str(), count, seconds);
+
+  std::size_t hits = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += container.find(key) != container.end();
+  });
+  s21_bench::Report((name + " find").c_str(), count, seconds);
+
+  long sum = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (const auto &value : container) sum += KeyOf(value);
+  });
+  s21_bench::Report((name + " iterate").c_str(), count, seconds);
+  std::printf("%-40s %12.1f B/element\n", (name + " memory").c_str(),
+              static_cast<double>(resident) / count);
+  s21_bench::DoNotOptimize(hits);
+  s21_bench::DoNotOptimize(sum);
+}
+
+// Each container runs in its own process so RSS is not shared between them.
+template <typename Container>
+void RunIsolated(const char *name, std::size_t count) {
+  std::fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    Run<Container>(name, count);
+    std::fflush(stdout);
+    _exit(0);
+  }
+  waitpid(child, nullptr, 0);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 100000, 1000000}) {
+    std::printf("n = %zu\n", count);
+    RunIsolated<s21::set<int>>("s21::set<int>", count);
+    RunIsolated<s21::btree_set<int>>("s21::btree_set<int>", count);
+    RunIsolated<std::set<int>>("std::set<int>", count);
+    RunIsolated<s21::map<int, int>>("s21::map<int, int>", count);
+    RunIsolated<s21::btree_map<int, int>>("s21::btree_map<int, int>", count);
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+void BenchSize(std::size_t count) {
+  std::vector<int> shuffled = s21_bench::ShuffledKeys(count, 42);
+  std::vector<int> sorted(shuffled);
+  std::sort(sorted.begin(), sorted.end());
+
+  std::printf("n = %zu\n", count);
+  double seconds = s21_bench::SecondsOf([&] {
+    s21::set<int> s21_set;
+    for (int key : sorted) s21_set.insert(key);
+    s21_bench::DoNotOptimize(s21_set.size());
+  });
+  s21_bench::Report("insert loop (sorted input)", count, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    s21::set<int> s21_set;
+    s21_set.assign_sorted(sorted.begin(), sorted.end());
+    s21_bench::DoNotOptimize(s21_set.size());
+  });
+  s21_bench::Report("assign_sorted", count, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    s21::set<int> s21_set;
+    for (int key : shuffled) s21_set.insert(key);
+    s21_bench::DoNotOptimize(s21_set.size());
+  });
+  s21_bench::Report("insert loop (shuffled input)", count, seconds);
+
+  for (unsigned threads : {1u, 4u, 0u}) {
+    seconds = s21_bench::SecondsOf([&] {
+      s21::set<int> s21_set;
+      s21_set.assign_parallel(shuffled.begin(), shuffled.end(), threads);
+      s21_bench::DoNotOptimize(s21_set.size());
+    });
+    char name[64];
+    std::snprintf(name, sizeof(name), "assign_parallel (%u threads)", threads);
+    s21_bench::Report(threads ? name : "assign_parallel (all cores)", count,
+                      seconds);
+  }
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 100000, 1000000}) BenchSize(count);
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include <sys/wait.h>
+
+#include <map>
+
+#include "../s21_containers/s21_map.h"
+#include "s21_bench.h"
+
+namespace {
+// Keeps count keys live while replacing one at random per iteration, so every
+// erase is followed by an insert that can reuse the freed node.
+template <typename Map>
+void Churn(const char *name, std::size_t count, std::size_t rounds) {
+  std::size_t resident_before = s21_bench::ResidentBytes();
+  std::mt19937 random(1);
+  std::vector<int> live = s21_bench::ShuffledKeys(count, 3);
+  int next_key = static_cast<int>(count);
+  Map map;
+  for (int key : live) map.insert({key, key});
+
+  double seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < rounds; ++i) {
+      std::size_t victim = random() % count;
+      map.erase(map.find(live[victim]));
+      live[victim] = next_key++;
+      map.insert({live[victim], live[victim]});
+    }
+  });
+
+  std::size_t resident = s21_bench::ResidentBytes() - resident_before;
+  std::printf("%-12s n = %-8zu %12.0f ops/s %8.1f MiB RSS %6.1f B/entry\n",
+              name, count, 2 * rounds / seconds, resident / 1048576.0,
+              static_cast<double>(resident) / count);
+}
+
+// Each variant runs in its own process so RSS is not shared between them.
+template <typename Map>
+void RunIsolated(const char *name, std::size_t count, std::size_t rounds) {
+  std::fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    Churn<Map>(name, count, rounds);
+    std::fflush(stdout);
+    _exit(0);
+  }
+  waitpid(child, nullptr, 0);
+}
+}  // namespace
+
+int main() {
+  std::printf("churn: erase + insert of a random key, pooled s21::map vs "
+              "new/delete per node\n");
+  for (std::size_t count : {10000, 1000000}) {
+    RunIsolated<s21::map<int, int>>("s21::map", count, 2000000);
+    RunIsolated<std::map<int, int>>("std::map", count, 2000000);
+  }
+  return 0;
+}
@@ -0,0 +1,143 @@
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers/s21_map.h"
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+template <typename Key>
+using CompactSet =
+    s21::set<Key, std::less<Key>, std::allocator<Key>, s21::compact_layout>;
+
+template <typename Key, typename T>
+using CompactMap =
+    s21::map<Key, T, std::less<Key>, std::allocator<std::pair<const Key, T>>,
+             s21::compact_layout>;
+
+template <typename Key>
+using ArenaSet =
+    s21::set<Key, std::less<Key>, std::allocator<Key>, s21::arena_layout>;
+
+template <typename Key, typename T>
+using ArenaMap =
+    s21::map<Key, T, std::less<Key>, std::allocator<std::pair<const Key, T>>,
+             s21::arena_layout>;
+
+template <typename Set>
+void Insert(Set &set, int key) {
+  set.insert(static_cast<typename Set::key_type>(key));
+}
+
+template <typename Key, typename T, typename C, typename A, typename L>
+void Insert(s21::map<Key, T, C, A, L> &map, int key) {
+  map.insert({key, T()});
+}
+
+// Fills a container with shuffled keys one insert at a time, then reads it
+// back, and returns the resident memory it took per element.
+template <typename Set>
+double Run(const std::string &name, std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  std::vector<int> probes = s21_bench::ShuffledKeys(count, 43);
+  std::size_t resident_before = s21_bench::ResidentBytes();
+
+  std::optional<Set> built;
+  built.emplace();
+  Set &set = *built;
+  double seconds = s21_bench::SecondsOf([&] {
+    for (int key : keys) Insert(set, key);
+  });
+  std::size_t resident = s21_bench::ResidentBytes() - resident_before;
+  s21_bench::Report((name + " insert").c_str(), count, seconds);
+
+  long hits = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += set.contains(key);
+  });
+  s21_bench::Report((name + " contains").c_str(), count, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (auto it = set.begin(); it != set.end(); ++it) ++hits;
+  });
+  s21_bench::Report((name + " iterate").c_str(), count, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    Set copy(set);
+    hits += copy.size();
+  });
+  s21_bench::Report((name + " copy").c_str(), count, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < count; i += 2) set.erase(set.find(keys[i]));
+  });
+  s21_bench::Report((name + " erase").c_str(), count / 2, seconds);
+
+  double per_element = static_cast<double>(resident) / count;
+  std::printf("%-40s %12.1f B/element\n", (name + " memory").c_str(),
+              per_element);
+  s21_bench::DoNotOptimize(hits);
+  return per_element;
+}
+
+// Runs in a child process, so that each container is measured on a heap
+// nothing else has touched, and hands the footprint back through a pipe.
+template <typename Set>
+double RunIsolated(const std::string &name, std::size_t count) {
+  int channel[2];
+  if (pipe(channel) != 0) return 0;
+  std::fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    close(channel[0]);
+    double per_element = Run<Set>(name, count);
+    std::fflush(stdout);
+    ssize_t written = write(channel[1], &per_element, sizeof(per_element));
+    _exit(written == sizeof(per_element) ? 0 : 1);
+  }
+
+  close(channel[1]);
+  double per_element = 0;
+  if (read(channel[0], &per_element, sizeof(per_element)) !=
+      sizeof(per_element))
+    per_element = 0;
+  close(channel[0]);
+  waitpid(child, nullptr, 0);
+  return per_element;
+}
+
+void ReportSaved(const std::string &name, double ranked, double other) {
+  std::printf("%-40s %12.1f B/element (%.0f%%)\n", name.c_str(),
+              ranked - other,
+              ranked > 0 ? 100 * (ranked - other) / ranked : 0.0);
+}
+
+template <typename Ranked, typename Compact, typename Arena>
+void Compare(const std::string &name, std::size_t count) {
+  double ranked = RunIsolated<Ranked>(name, count);
+  double compact = RunIsolated<Compact>(name + ", compact", count);
+  double arena = RunIsolated<Arena>(name + ", arena", count);
+  ReportSaved(name + " saved by compact", ranked, compact);
+  ReportSaved(name + " saved by arena", ranked, arena);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {100000, 1000000, 4000000}) {
+    std::printf("n = %zu\n", count);
+    Compare<s21::set<int>, CompactSet<int>, ArenaSet<int>>("s21::set<int>",
+                                                           count);
+    Compare<s21::set<long>, CompactSet<long>, ArenaSet<long>>(
+        "s21::set<long>", count);
+    Compare<s21::map<int, int>, CompactMap<int, int>, ArenaMap<int, int>>(
+        "s21::map<int, int>", count);
+  }
+  return 0;
+}
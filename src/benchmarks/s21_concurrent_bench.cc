@@ -0,0 +1,97 @@
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers/s21_concurrent_map.h"
+#include "../s21_containers/s21_map.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kKeys = 100000;
+constexpr std::size_t kOpsPerThread = 200000;
+
+// What the threads share before this change: one map behind one mutex.
+class LockedMap {
+ public:
+  bool find(int key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+  void insert_or_assign(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) map_.erase(it);
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  s21::map<int, int> map_;
+};
+
+class ShardedMap {
+ public:
+  bool find(int key) const { return map_.contains(key); }
+  void insert_or_assign(int key, int value) {
+    map_.insert_or_assign(key, value);
+  }
+  void erase(int key) { map_.erase(key); }
+
+ private:
+  s21::concurrent_map<int, int> map_;
+};
+
+// Every thread runs the same mix on shared keys: 90% lookups, 5% writes
+// and 5% erases. The operations are drawn before the clock starts.
+template <typename Map>
+void Run(const std::string &name, int threads) {
+  Map map;
+  for (int key = 0; key < kKeys; key += 2) map.insert_or_assign(key, key);
+
+  std::vector<std::vector<unsigned>> ops(threads);
+  for (int id = 0; id < threads; ++id) {
+    std::mt19937 rng(id);
+    for (std::size_t i = 0; i < kOpsPerThread; ++i) ops[id].push_back(rng());
+  }
+
+  std::vector<std::size_t> hits(threads);
+  double seconds = s21_bench::SecondsOf([&] {
+    std::vector<std::thread> workers;
+    for (int id = 0; id < threads; ++id) {
+      workers.emplace_back([&, id] {
+        for (unsigned op : ops[id]) {
+          int key = static_cast<int>(op % kKeys);
+          unsigned kind = op / kKeys % 20;
+          if (kind == 0)
+            map.insert_or_assign(key, key);
+          else if (kind == 1)
+            map.erase(key);
+          else
+            hits[id] += map.find(key);
+        }
+      });
+    }
+    for (std::thread &worker : workers) worker.join();
+  });
+
+  s21_bench::Report((name + " x" + std::to_string(threads)).c_str(),
+                    kOpsPerThread * threads, seconds);
+  s21_bench::DoNotOptimize(hits);
+}
+}  // namespace
+
+int main() {
+  std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+  for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+    Run<LockedMap>("mutex + s21::map", threads);
+    Run<ShardedMap>("s21::concurrent_map", threads);
+  }
+  return 0;
+}
@@ -0,0 +1,116 @@
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers/s21_concurrent_ordered_map.h"
+#include "../s21_containers/s21_map.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kKeys = 100000;
+constexpr int kScanLength = 16;
+constexpr std::size_t kOpsPerThread = 100000;
+
+// What the threads share before this change: one map behind one mutex.
+class LockedMap {
+ public:
+  bool find(int key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+  void insert(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert(key, key);
+  }
+
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) map_.erase(it);
+  }
+
+  long scan(int from) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    long sum = 0;
+    int left = kScanLength;
+    for (auto it = map_.lower_bound(from); it != map_.end() && left--; ++it)
+      sum += (*it).second;
+    return sum;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  s21::map<int, int> map_;
+};
+
+class SkipListMap {
+ public:
+  bool find(int key) const { return map_.contains(key); }
+  void insert(int key) { map_.insert(key, key); }
+  void erase(int key) { map_.erase(key); }
+
+  long scan(int from) const {
+    long sum = 0;
+    int left = kScanLength;
+    for (auto it = map_.lower_bound(from); it != map_.end() && left--; ++it)
+      sum += it->second;
+    return sum;
+  }
+
+ private:
+  s21::concurrent_ordered_map<int, int> map_;
+};
+
+// Every thread runs the same mix on shared keys: 85% lookups, 5% inserts,
+// 5% erases and 5% scans of 16 elements from a lower bound. The operations
+// are drawn before the clock starts.
+template <typename Map>
+void Run(const std::string &name, int threads) {
+  Map map;
+  for (int key = 0; key < kKeys; key += 2) map.insert(key);
+
+  std::vector<std::vector<unsigned>> ops(threads);
+  for (int id = 0; id < threads; ++id) {
+    std::mt19937 rng(id);
+    for (std::size_t i = 0; i < kOpsPerThread; ++i) ops[id].push_back(rng());
+  }
+
+  std::vector<long> results(threads);
+  double seconds = s21_bench::SecondsOf([&] {
+    std::vector<std::thread> workers;
+    for (int id = 0; id < threads; ++id) {
+      workers.emplace_back([&, id] {
+        for (unsigned op : ops[id]) {
+          int key = static_cast<int>(op % kKeys);
+          unsigned kind = op / kKeys % 20;
+          if (kind == 0)
+            map.insert(key);
+          else if (kind == 1)
+            map.erase(key);
+          else if (kind == 2)
+            results[id] += map.scan(key);
+          else
+            results[id] += map.find(key);
+        }
+      });
+    }
+    for (std::thread &worker : workers) worker.join();
+  });
+
+  s21_bench::Report((name + " x" + std::to_string(threads)).c_str(),
+                    kOpsPerThread * threads, seconds);
+  s21_bench::DoNotOptimize(results);
+}
+}  // namespace
+
+int main() {
+  std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+  for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+    Run<LockedMap>("mutex + s21::map", threads);
+    Run<SkipListMap>("s21::concurrent_ordered_map", threads);
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+#include <sys/wait.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers/s21_btree_map.h"
+#include "../s21_containers/s21_flat_map.h"
+#include "../s21_containers/s21_map.h"
+#include "s21_bench.h"
+
+namespace {
+// Builds a map once from unsorted pairs, then reads it many times: the
+// pattern flat_map is meant for.
+template <typename Map>
+void Run(const std::string &name, std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  std::vector<std::pair<const int, int>> items;
+  for (int key : keys) items.emplace_back(key, key);
+  std::vector<int> probes = s21_bench::ShuffledKeys(count, 43);
+  std::size_t resident_before = s21_bench::ResidentBytes();
+
+  std::optional<Map> built;
+  double seconds = s21_bench::SecondsOf([&] {
+    built.emplace(items.begin(), items.end());
+  });
+  const Map &map = *built;
+  std::size_t resident = s21_bench::ResidentBytes() - resident_before;
+  s21_bench::Report((name + " build").c_str(), count, seconds);
+
+  const std::size_t lookups = 2000000;
+  long sum = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < lookups; ++i)
+      sum += map.find(probes[i % count]) != map.end();
+  });
+  s21_bench::Report((name + " find").c_str(), lookups, seconds);
+  std::printf("%-40s %12.1f B/element\n", (name + " memory").c_str(),
+              static_cast<double>(resident) / count);
+  s21_bench::DoNotOptimize(sum);
+}
+
+// s21::map and btree_map have no range constructor; they take the same
+// pairs one insert at a time.
+template <typename Map>
+struct RangeBuilt : Map {
+  RangeBuilt() = default;
+  template <typename It>
+  RangeBuilt(It first, It last) {
+    for (; first != last; ++first) this->insert(*first);
+  }
+};
+
+template <typename Map>
+void RunIsolated(const char *name, std::size_t count) {
+  std::fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    Run<Map>(name, count);
+    std::fflush(stdout);
+    _exit(0);
+  }
+  waitpid(child, nullptr, 0);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 100000, 1000000}) {
+    std::printf("n = %zu\n", count);
+    RunIsolated<RangeBuilt<s21::map<int, int>>>("s21::map", count);
+    RunIsolated<RangeBuilt<s21::btree_map<int, int>>>("s21::btree_map", count);
+    RunIsolated<s21::flat_map<int, int>>("s21::flat_map", count);
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <cstdio>
+#include <set>
+#include <vector>
+
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+void BenchStream(const char *stream, const std::vector<int> &keys) {
+  std::printf("%s stream, n = %zu\n", stream, keys.size());
+
+  double seconds = s21_bench::SecondsOf([&] {
+    s21::set<int> s21_set;
+    for (int key : keys) s21_set.insert(key);
+    s21_bench::DoNotOptimize(s21_set.size());
+  });
+  s21_bench::Report("s21::set::insert", keys.size(), seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    s21::set<int> s21_set;
+    auto hint = s21_set.end();
+    for (int key : keys) hint = s21_set.insert(hint, key);
+    s21_bench::DoNotOptimize(s21_set.size());
+  });
+  s21_bench::Report("s21::set::insert (previous as hint)", keys.size(),
+                    seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    s21::set<int> s21_set;
+    for (int key : keys) s21_set.insert(s21_set.end(), key);
+    s21_bench::DoNotOptimize(s21_set.size());
+  });
+  s21_bench::Report("s21::set::insert (end() as hint)", keys.size(),
+                    seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    std::set<int> std_set;
+    auto hint = std_set.end();
+    for (int key : keys) hint = std_set.insert(hint, key);
+    s21_bench::DoNotOptimize(std_set.size());
+  });
+  s21_bench::Report("std::set::insert (previous as hint)", keys.size(),
+                    seconds);
+}
+}  // namespace
+
+int main() {
+  const std::size_t count = 1000000;
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 11);
+  BenchStream("random", keys);
+  std::sort(keys.begin(), keys.end());
+  BenchStream("sorted", keys);
+  std::reverse(keys.begin(), keys.end());
+  BenchStream("reverse-sorted", keys);
+  return 0;
+}
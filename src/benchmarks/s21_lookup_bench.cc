@@ -0,0 +1,96 @@
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "../s21_containers/s21_map.h"
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+// The lookup the containers used before they descended the tree.
+template <typename Set>
+typename Set::iterator LinearFind(const Set &s, int key) {
+  for (auto it = s.begin(); it != s.end(); ++it)
+    if (*it == key) return it;
+  return s.end();
+}
+
+void BenchSize(std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  s21::set<int> s21_set;
+  s21::map<int, int> s21_map;
+  std::set<int> std_set;
+  for (int key : keys) {
+    s21_set.insert(key);
+    s21_map.insert(key, key);
+    std_set.insert(key);
+  }
+
+  std::printf("n = %zu\n", count);
+  const std::size_t lookups = 200000;
+  std::size_t hits = 0;
+  double seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < lookups; ++i)
+      hits += s21_set.contains(keys[i % count]);
+  });
+  s21_bench::Report("s21::set::contains", lookups, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < lookups; ++i)
+      hits += s21_map.at(keys[i % count]);
+  });
+  s21_bench::Report("s21::map::at", lookups, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < lookups; ++i)
+      hits += std_set.count(keys[i % count]);
+  });
+  s21_bench::Report("std::set::count", lookups, seconds);
+
+  // The linear scan is far too slow to run the full lookup count.
+  const std::size_t scans = count > 100000 ? 20 : 2000;
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < scans; ++i)
+      hits += LinearFind(s21_set, keys[i % count]) != s21_set.end();
+  });
+  s21_bench::Report("linear scan (previous find)", scans, seconds);
+  s21_bench::DoNotOptimize(hits);
+}
+// Looks up string_view keys, with and without a transparent comparator.
+void BenchHeterogeneous(std::size_t count) {
+  std::vector<std::string> names;
+  for (int key : s21_bench::ShuffledKeys(count, 7))
+    names.push_back("request-handler-" + std::to_string(key));
+  std::vector<std::string_view> views(names.begin(), names.end());
+
+  s21::set<std::string> plain;
+  s21::set<std::string, std::less<>> transparent;
+  for (const std::string &name : names) {
+    plain.insert(name);
+    transparent.insert(name);
+  }
+
+  std::printf("string_view lookups, n = %zu\n", count);
+  const std::size_t lookups = 200000;
+  std::size_t hits = 0;
+  double seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < lookups; ++i)
+      hits += plain.contains(std::string(views[i % count]));
+  });
+  s21_bench::Report("std::less<std::string> (temporary key)", lookups,
+                    seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < lookups; ++i)
+      hits += transparent.contains(views[i % count]);
+  });
+  s21_bench::Report("std::less<> (transparent)", lookups, seconds);
+  s21_bench::DoNotOptimize(hits);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 100000, 1000000}) BenchSize(count);
+  BenchHeterogeneous(100000);
+  return 0;
+}
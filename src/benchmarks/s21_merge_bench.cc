@@ -0,0 +1,59 @@
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include "../s21_containers/s21_map.h"
+#include "s21_bench.h"
+
+namespace {
+// Merges a map of other_count keys into one of count keys, a tenth of them
+// shared, and compares against copying into new nodes as merge used to.
+void BenchMerge(std::size_t count, std::size_t other_count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count + other_count, 3);
+  std::printf("merge %zu into %zu\n", other_count, count);
+
+  const std::size_t rounds = std::max<std::size_t>(1, 2000000 / count);
+  double seconds = 0;
+  for (std::size_t round = 0; round < rounds; ++round) {
+    s21::map<int, int> target, source;
+    for (std::size_t i = 0; i < count; ++i) target.insert(keys[i], 0);
+    for (std::size_t i = count - other_count / 10; i < count + other_count;
+         ++i)
+      source.insert(keys[i], 1);
+    seconds += s21_bench::SecondsOf([&] {
+      for (const auto &pair : source) target.insert(pair);
+      source.clear();
+    });
+  }
+  s21_bench::Report("copy + clear (previous merge)", rounds, seconds);
+
+  seconds = 0;
+  for (std::size_t round = 0; round < rounds; ++round) {
+    s21::map<int, int> target, source;
+    for (std::size_t i = 0; i < count; ++i) target.insert(keys[i], 0);
+    for (std::size_t i = count - other_count / 10; i < count + other_count;
+         ++i)
+      source.insert(keys[i], 1);
+    seconds += s21_bench::SecondsOf([&] { target.merge(source); });
+  }
+  s21_bench::Report("s21::map::merge", rounds, seconds);
+
+  seconds = 0;
+  for (std::size_t round = 0; round < rounds; ++round) {
+    std::map<int, int> target, source;
+    for (std::size_t i = 0; i < count; ++i) target.emplace(keys[i], 0);
+    for (std::size_t i = count - other_count / 10; i < count + other_count;
+         ++i)
+      source.emplace(keys[i], 1);
+    seconds += s21_bench::SecondsOf([&] { target.merge(source); });
+  }
+  s21_bench::Report("std::map::merge", rounds, seconds);
+}
+}  // namespace
+
+int main() {
+  BenchMerge(1000, 1000);
+  BenchMerge(100000, 100000);
+  BenchMerge(100000, 100);
+  return 0;
+}
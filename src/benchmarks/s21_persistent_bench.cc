@@ -0,0 +1,63 @@
+#include <vector>
+
+#include "../s21_containers/s21_map.h"
+#include "../s21_containers/s21_persistent_map.h"
+#include "s21_bench.h"
+
+namespace {
+// A writer that publishes a new version after every update: s21::map has
+// to be copied whole, persistent_map takes a snapshot and path-copies.
+void RunVersions(std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  std::size_t rounds = std::max<std::size_t>(10, 2000000 / count);
+
+  s21::map<int, int> map;
+  s21::persistent_map<int, int> persistent;
+  for (int key : keys) {
+    map.insert(key, key);
+    persistent.insert(key, key);
+  }
+
+  std::size_t sizes = 0;
+  double seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < rounds; ++i) {
+      s21::map<int, int> version(map);
+      version.insert_or_assign(keys[i % count], static_cast<int>(i));
+      sizes += version.size();
+    }
+  });
+  s21_bench::Report("s21::map copy + update", rounds, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < rounds; ++i) {
+      s21::persistent_map<int, int> version = persistent.snapshot();
+      version.insert_or_assign(keys[i % count], static_cast<int>(i));
+      sizes += version.size();
+    }
+  });
+  s21_bench::Report("s21::persistent_map snapshot + update", rounds,
+                    seconds);
+
+  std::vector<int> probes = s21_bench::ShuffledKeys(count, 43);
+  std::size_t hits = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += map.contains(key);
+  });
+  s21_bench::Report("s21::map find", count, seconds);
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += persistent.contains(key);
+  });
+  s21_bench::Report("s21::persistent_map find", count, seconds);
+
+  s21_bench::DoNotOptimize(sizes);
+  s21_bench::DoNotOptimize(hits);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 100000, 1000000}) {
+    std::printf("n = %zu\n", count);
+    RunVersions(count);
+  }
+  return 0;
+}
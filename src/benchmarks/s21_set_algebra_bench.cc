@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+// Intersects a set of lhs_count keys with one of rhs_count keys, half of
+// which are shared, the way a tag check intersects a request's tags with a
+// policy's.
+void BenchIntersection(std::size_t lhs_count, std::size_t rhs_count) {
+  std::vector<int> lhs_keys = s21_bench::ShuffledKeys(lhs_count * 2, 1);
+  std::vector<int> rhs_keys = s21_bench::ShuffledKeys(rhs_count * 2, 2);
+  lhs_keys.resize(lhs_count);
+  rhs_keys.resize(rhs_count);
+
+  s21::set<int> lhs, rhs;
+  std::set<int> std_lhs, std_rhs;
+  for (int key : lhs_keys) {
+    lhs.insert(key);
+    std_lhs.insert(key);
+  }
+  for (int key : rhs_keys) {
+    rhs.insert(key);
+    std_rhs.insert(key);
+  }
+
+  std::printf("intersection, %zu x %zu\n", lhs_count, rhs_count);
+  const std::size_t rounds = std::max<std::size_t>(1, 2000000 / rhs_count);
+  double seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < rounds; ++i) {
+      s21::set<int> result;
+      for (int key : lhs)
+        if (rhs.contains(key)) result.insert(key);
+      s21_bench::DoNotOptimize(result.size());
+    }
+  });
+  s21_bench::Report("contains + insert loop", rounds, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < rounds; ++i)
+      s21_bench::DoNotOptimize(s21::set_intersection(lhs, rhs).size());
+  });
+  s21_bench::Report("s21::set_intersection", rounds, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < rounds; ++i) {
+      std::set<int> result;
+      std::set_intersection(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                            std_rhs.end(),
+                            std::inserter(result, result.end()));
+      s21_bench::DoNotOptimize(result.size());
+    }
+  });
+  s21_bench::Report("std::set_intersection into std::set", rounds, seconds);
+}
+}  // namespace
+
+int main() {
+  BenchIntersection(1000, 1000);
+  BenchIntersection(100000, 100000);
+  BenchIntersection(16, 100000);
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include <string>
+#include <vector>
+
+#include "../s21_containers/s21_flat_set.h"
+#include "../s21_containers/s21_set.h"
+#include "../s21_containers/s21_static_set.h"
+#include "s21_bench.h"
+
+namespace {
+// Random lookups, half of them misses, in a set that is built once: the
+// tree it was built in, the same keys binary-searched in a sorted array,
+// and the frozen set.
+template <typename Set>
+void RunLookups(const std::string &name, const Set &set,
+                const std::vector<int> &probes) {
+  long hits = 0;
+  double seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += set.contains(key);
+  });
+  s21_bench::Report((name + " contains").c_str(), probes.size(), seconds);
+
+  long sum = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) {
+      auto it = set.lower_bound(key);
+      sum += it != set.end() ? *it : 0;
+    }
+  });
+  s21_bench::Report((name + " lower_bound").c_str(), probes.size(), seconds);
+  s21_bench::DoNotOptimize(hits);
+  s21_bench::DoNotOptimize(sum);
+}
+
+void Run(std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  for (int &key : keys) key *= 2;
+  std::vector<int> probes = s21_bench::ShuffledKeys(2 * count, 43);
+  probes.resize(std::max<std::size_t>(count, 1000000));
+  for (std::size_t i = 2 * count; i < probes.size(); ++i)
+    probes[i] = probes[i % (2 * count)];
+
+  s21::set<int> tree;
+  for (int key : keys) tree.insert(key);
+  s21::flat_set<int> flat(keys.begin(), keys.end());
+  s21::static_set<int> frozen;
+  double seconds = s21_bench::SecondsOf([&] { frozen = tree.freeze(); });
+  s21_bench::Report("s21::set::freeze", count, seconds);
+
+  RunLookups("s21::set", tree, probes);
+  RunLookups("s21::flat_set", flat, probes);
+  RunLookups("s21::static_set", frozen, probes);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 100000, 1000000, 10000000}) {
+    std::printf("n = %zu\n", count);
+    Run(count);
+  }
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include <string>
+#include <vector>
+
+#include "../s21_containers/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+using CountingSet = s21::set<int, std::less<int>, std::allocator<int>,
+                             s21::ranked_layout, s21::counting_stats>;
+
+template <typename Set>
+Set Run(const std::string &name, const std::vector<int> &keys,
+        const std::vector<int> &probes) {
+  Set set;
+  double seconds = s21_bench::SecondsOf([&] {
+    for (int key : keys) set.insert(key);
+  });
+  s21_bench::Report((name + " insert").c_str(), keys.size(), seconds);
+
+  long hits = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += set.contains(key);
+  });
+  s21_bench::Report((name + " contains").c_str(), probes.size(), seconds);
+  s21_bench::DoNotOptimize(hits);
+  return set;
+}
+
+void PrintStats(const std::string &name, const CountingSet &set) {
+  s21::tree_stats stats = set.stats();
+  double count = static_cast<double>(set.size());
+  std::printf(
+      "%-40s %.1f comparisons, %.2f rotations, %.2f fixups per key, "
+      "height %zu\n",
+      name.c_str(), stats.comparisons / count,
+      (stats.left_rotations + stats.right_rotations) / count,
+      stats.insert_fixups / count, set.height());
+}
+}  // namespace
+
+// What counting_stats costs against the default no_stats, and what it
+// shows for shuffled and for ascending keys.
+int main() {
+  for (std::size_t count : {100000, 1000000}) {
+    std::printf("n = %zu\n", count);
+    std::vector<int> shuffled = s21_bench::ShuffledKeys(count, 42);
+    std::vector<int> probes = s21_bench::ShuffledKeys(count, 43);
+    std::vector<int> ascending(count);
+    for (std::size_t i = 0; i < count; ++i)
+      ascending[i] = static_cast<int>(i);
+
+    Run<s21::set<int>>("s21::set<int>", shuffled, probes);
+    CountingSet shuffled_set =
+        Run<CountingSet>("s21::set<int>, counting", shuffled, probes);
+    PrintStats("shuffled keys", shuffled_set);
+    CountingSet ascending_set =
+        Run<CountingSet>("set<int>, counting, ascending", ascending, probes);
+    PrintStats("ascending keys", ascending_set);
+  }
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <sys/wait.h>
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "../s21_containers/s21_map.h"
+#include "../s21_containers/s21_unordered_map.h"
+#include "s21_bench.h"
+
+namespace {
+// Inserts count shuffled keys, looks up each of them and as many missing
+// ones, then erases half the keys and looks them all up again, which is
+// where tombstones would start to slow the probes down.
+template <typename Map>
+void Run(const std::string &name, std::size_t count) {
+  std::vector<int> keys = s21_bench::ShuffledKeys(count, 42);
+  std::vector<int> probes = s21_bench::ShuffledKeys(count, 43);
+  std::size_t resident_before = s21_bench::ResidentBytes();
+  Map map;
+
+  double seconds = s21_bench::SecondsOf([&] {
+    for (int key : keys) map.insert({key, key});
+  });
+  std::size_t resident = s21_bench::ResidentBytes() - resident_before;
+  s21_bench::Report((name + " insert").c_str(), count, seconds);
+
+  std::size_t hits = 0;
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += map.find(key) != map.end();
+  });
+  s21_bench::Report((name + " find hit").c_str(), count, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += map.find(-1 - key) != map.end();
+  });
+  s21_bench::Report((name + " find miss").c_str(), count, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (std::size_t i = 0; i < count / 2; ++i) {
+      auto it = map.find(keys[i]);
+      if (it != map.end()) map.erase(it);
+    }
+  });
+  s21_bench::Report((name + " erase half").c_str(), count / 2, seconds);
+
+  seconds = s21_bench::SecondsOf([&] {
+    for (int key : probes) hits += map.find(key) != map.end();
+  });
+  s21_bench::Report((name + " refind").c_str(), count, seconds);
+
+  std::printf("%-40s %12.1f B/element\n", (name + " memory").c_str(),
+              static_cast<double>(resident) / count);
+  s21_bench::DoNotOptimize(hits);
+}
+
+// Each container runs in its own process so RSS is not shared between them.
+template <typename Map>
+void RunIsolated(const char *name, std::size_t count) {
+  std::fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    Run<Map>(name, count);
+    std::fflush(stdout);
+    _exit(0);
+  }
+  waitpid(child, nullptr, 0);
+}
+}  // namespace
+
+int main() {
+  for (std::size_t count : {1000, 100000, 1000000}) {
+    std::printf("n = %zu\n", count);
+    RunIsolated<s21::map<int, int>>("s21::map<int, int>", count);
+    RunIsolated<s21::unordered_map<int, int>>("s21::unordered_map<int, int>",
+                                              count);
+    RunIsolated<std::unordered_map<int, int>>("std::unordered_map<int, int>",
+                                              count);
+  }
+  return 0;
+}
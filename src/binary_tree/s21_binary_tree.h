@@ -1,62 +1,262 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_BINARY_TREE_H
 #define CPP2_S21_CONTAINERS_1_S21_BINARY_TREE_H
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "../s21_containers/s21_vector.h"
+#include "s21_key_of_value.h"
+#include "s21_node_arena.h"
+#include "s21_node_pool.h"
+#include "s21_parallel_sort.h"
+
 namespace s21 {
-template <typename T>
+// How RedBlackTree lays out the links of its nodes. ranked_layout, the
+// default, keeps a count of every node's subtree beside the color bit, which
+// nth() and rank() descend by. compact_layout drops the count and hides the
+// color in the low bit of the parent pointer, so a node carries three words
+// of links instead of four, at the price of nth() and rank(). arena_layout
+// goes further: the nodes live in one contiguous NodeArena and link by
+// 32-bit offsets, three of them to a node, so the links of an int take 12
+// bytes rather than 24 or 32. It has no nth() or rank() either, and since
+// the arena moves when it grows, an insertion that grows it invalidates
+// every iterator; reserve() ahead keeps them valid.
+struct ranked_layout {};
+struct compact_layout {};
+struct arena_layout {};
+
+// Whether RedBlackTree keeps count of its work. no_stats, the default,
+// counts nothing and costs nothing. counting_stats counts into relaxed
+// atomics, so lookups running side by side under a shared lock stay free of
+// data races, at the price of an occasional lost count.
+struct no_stats {};
+struct counting_stats {};
+
+// What stats() reports for a counting_stats tree: comparator calls, single
+// rotations each way, rounds of the rebalancing loops after an insertion or
+// an erasure, and nodes allocated, all since the tree was made.
+struct tree_stats {
+  size_t comparisons = 0;
+  size_t left_rotations = 0;
+  size_t right_rotations = 0;
+  size_t insert_fixups = 0;
+  size_t delete_fixups = 0;
+  size_t allocations = 0;
+};
+
+// Nodes are ordered by Compare applied to the key KeyOfValue extracts from the
+// stored value, so a map can be searched by its key alone without building a
+// whole pair. A Compare with is_transparent also enables the lookup templates,
+// which take any type the comparator accepts against Key. Node memory comes
+// from Allocator through the tree's NodePool, or its NodeArena. Layout is
+// one of the node layouts above and Stats one of the stats policies.
+template <typename T, typename Key = T, typename KeyOfValue = Identity<T>,
+          typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<T>,
+          typename Layout = ranked_layout, typename Stats = no_stats>
 class RedBlackTree {
  public:
   using key_value = T;
+  using key_type = Key;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using layout_type = Layout;
 
  private:
-  enum Color { RED, BLACK };
+  static_assert(std::is_same<Layout, ranked_layout>::value ||
+                    std::is_same<Layout, compact_layout>::value ||
+                    std::is_same<Layout, arena_layout>::value,
+                "RedBlackTree: unknown node layout");
+  static constexpr bool kRanked = std::is_same<Layout, ranked_layout>::value;
+  static constexpr bool kArena = std::is_same<Layout, arena_layout>::value;
+  static_assert(std::is_same<Stats, no_stats>::value ||
+                    std::is_same<Stats, counting_stats>::value,
+                "RedBlackTree: unknown stats policy");
+  static constexpr bool kCounting = std::is_same<Stats, counting_stats>::value;
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  enum Color : unsigned char { RED, BLACK };
+
+  struct RankedNodeBase;
+  struct CompactNodeBase;
+  struct ArenaNodeBase;
+
+  // The links of a node, and all of the tree's header.
+  using NodeBase = std::conditional_t<
+      kRanked, RankedNodeBase,
+      std::conditional_t<kArena, ArenaNodeBase, CompactNodeBase>>;
+
+  // Every node counts the nodes of its subtree. The count shares a word with
+  // the color bit, so the node is no bigger than it would be without it.
+  // The parent and the color are reached through accessors, like those of
+  // the compact layout.
+  struct RankedNodeBase {
+    NodeBase* parent_ = nullptr;
+    NodeBase* left_ = nullptr;
+    NodeBase* right_ = nullptr;
+    Color color_ : 1;
+    size_t size : 63;
+
+    RankedNodeBase() noexcept : color_(RED), size(1) {}
+
+    NodeBase* parent() const noexcept { return parent_; }
+    void set_parent(NodeBase* parent) noexcept { parent_ = parent; }
+    NodeBase* left() const noexcept { return left_; }
+    void set_left(NodeBase* left) noexcept { left_ = left; }
+    NodeBase* right() const noexcept { return right_; }
+    void set_right(NodeBase* right) noexcept { right_ = right; }
+    Color color() const noexcept { return color_; }
+    void set_color(Color color) noexcept { color_ = color; }
+  };
+
+  // Nodes are at least pointer-aligned, so the low bit of the parent's
+  // address is always free to hold the color.
+  struct CompactNodeBase {
+    NodeBase* left() const noexcept { return left_; }
+    void set_left(NodeBase* left) noexcept { left_ = left; }
+    NodeBase* right() const noexcept { return right_; }
+    void set_right(NodeBase* right) noexcept { right_ = right; }
+    NodeBase* parent() const noexcept {
+      return reinterpret_cast<NodeBase*>(parent_and_color_ & ~kColorBit);
+    }
+    void set_parent(NodeBase* parent) noexcept {
+      parent_and_color_ =
+          reinterpret_cast<uintptr_t>(parent) | (parent_and_color_ & kColorBit);
+    }
+    Color color() const noexcept {
+      return static_cast<Color>(parent_and_color_ & kColorBit);
+    }
+    void set_color(Color color) noexcept {
+      parent_and_color_ = (parent_and_color_ & ~kColorBit) | color;
+    }
+
+   private:
+    static constexpr uintptr_t kColorBit = 1;
+
+    NodeBase* left_ = nullptr;
+    NodeBase* right_ = nullptr;
+    uintptr_t parent_and_color_ = RED;
+  };
+
+  // Links are offsets, counted in nodes, from the node to the one linked,
+  // so they hold wherever the arena is moved or copied to. The color is the
+  // low bit of the parent's offset. No node is its own parent, so offset 0
+  // there stands for none; children use kNone, as a child offset of 0 is the
+  // empty header pointing at itself.
+  struct ArenaNodeBase {
+    NodeBase* left() const noexcept { return Child(left_); }
+    void set_left(NodeBase* left) noexcept { left_ = ChildOffset(left); }
+    NodeBase* right() const noexcept { return Child(right_); }
+    void set_right(NodeBase* right) noexcept { right_ = ChildOffset(right); }
+    NodeBase* parent() const noexcept {
+      int32_t offset = parent_and_color_ >> 1;
+      return offset ? At(offset) : nullptr;
+    }
+    void set_parent(NodeBase* parent) noexcept {
+      parent_and_color_ = (parent ? OffsetOf(parent) * 2 : 0) |
+                          (parent_and_color_ & kColorBit);
+    }
+    Color color() const noexcept {
+      return static_cast<Color>(parent_and_color_ & kColorBit);
+    }
+    void set_color(Color color) noexcept {
+      parent_and_color_ = (parent_and_color_ & ~kColorBit) | color;
+    }
+
+   private:
+    static constexpr int32_t kColorBit = 1;
+    static constexpr int32_t kNone = INT32_MIN;
+
+    NodeBase* At(int32_t offset) const noexcept {
+      const char* self = reinterpret_cast<const char*>(this);
+      return reinterpret_cast<NodeBase*>(const_cast<char*>(
+          self + static_cast<ptrdiff_t>(offset) *
+                     static_cast<ptrdiff_t>(sizeof(Node))));
+    }
+    int32_t OffsetOf(const NodeBase* node) const noexcept {
+      return static_cast<int32_t>((reinterpret_cast<const char*>(node) -
+                                   reinterpret_cast<const char*>(this)) /
+                                  static_cast<ptrdiff_t>(sizeof(Node)));
+    }
+    NodeBase* Child(int32_t offset) const noexcept {
+      return offset == kNone ? nullptr : At(offset);
+    }
+    int32_t ChildOffset(const NodeBase* node) const noexcept {
+      return node ? OffsetOf(node) : kNone;
+    }
+
+    int32_t left_ = kNone;
+    int32_t right_ = kNone;
+    int32_t parent_and_color_ = RED;
+  };
 
-  struct Node {
+  struct Node : NodeBase {
     key_value data;
-    Node* parent;
-    Node* left;
-    Node* right;
-    Color color;
   };
 
+  using pool_type = std::conditional_t<kArena, NodeArena<Node, Allocator>,
+                                       NodePool<Node, Allocator>>;
+
+  // The counts behind stats(). Each is bumped by a relaxed load and store
+  // rather than a locked read-modify-write, which would cost more than the
+  // comparison it counts.
+  struct Counters {
+    std::atomic<size_t> comparisons{0};
+    std::atomic<size_t> left_rotations{0};
+    std::atomic<size_t> right_rotations{0};
+    std::atomic<size_t> insert_fixups{0};
+    std::atomic<size_t> delete_fixups{0};
+    std::atomic<size_t> allocations{0};
+  };
+
+  // Takes no room beside the comparator when nothing is counted.
+  struct NoCounters {};
+
+  using counters_type = std::conditional_t<kCounting, Counters, NoCounters>;
+
   class iterator {
    public:
-    explicit iterator(Node* node) noexcept : current_(node) {}
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = key_value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = key_value*;
+    using reference = key_value&;
 
-    iterator& operator++() noexcept {
-      if (current_->right) {
-        current_ = Minimum(current_->right);
-      } else {
-        Node* parent = current_->parent;
-        while (parent && current_ == parent->right) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
+    explicit iterator(NodeBase* node) noexcept : current_(node) {}
 
+    iterator& operator++() noexcept {
+      current_ = Next(current_);
       return *this;
     }
 
     iterator& operator++(int) noexcept {
-      if (current_->right) {
-        current_ = Minimum(current_->right);
-      } else {
-        Node* parent = current_->parent;
-        while (parent && current_ == parent->right) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
+      current_ = Next(current_);
+      return *this;
+    }
 
+    // Stepping back from end() reaches the last element.
+    iterator& operator--() noexcept {
+      current_ = Prev(current_);
       return *this;
     }
 
-    key_value& operator*() const noexcept { return current_->data; }
+    iterator& operator--(int) noexcept {
+      current_ = Prev(current_);
+      return *this;
+    }
+
+    key_value& operator*() const noexcept { return ValueOf(current_); }
+    key_value* operator->() const noexcept { return &ValueOf(current_); }
 
     bool operator==(const iterator& other) const noexcept {
       return current_ == other.current_;
@@ -67,345 +267,1624 @@ class RedBlackTree {
     }
 
    private:
-    Node* current_;
+    friend class RedBlackTree;
+
+    NodeBase* current_;
+  };
+
+  using pool_allocator = typename pool_type::allocator_type;
+
+  // Owns the node of one element taken out of a tree by extract() until
+  // insert() links that same node into a tree again, so pointers and
+  // references to the element stay valid throughout; the node keeps its
+  // slab alive even if the tree goes first. Only an arena tree, whose nodes
+  // cannot leave the arena, moves the element into storage of its own.
+  // Changing the key through value() or key() is allowed while the element
+  // is out of any tree.
+  class node_type {
+   public:
+    using value_type = key_value;
+    using allocator_type = Allocator;
+
+    node_type() noexcept = default;
+    node_type(node_type&& other) noexcept
+        : node_(std::exchange(other.node_, nullptr)),
+          ticket_(other.ticket_),
+          alloc_(other.alloc_) {}
+    ~node_type() noexcept { Reset(); }
+
+    node_type& operator=(node_type&& other) noexcept {
+      if (this != &other) {
+        Reset();
+        node_ = std::exchange(other.node_, nullptr);
+        ticket_ = other.ticket_;
+        alloc_ = other.alloc_;
+      }
+      return *this;
+    }
+
+    bool empty() const noexcept { return node_ == nullptr; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+
+    value_type& value() const noexcept { return node_->data; }
+
+    // For maps, whose value_type is a pair.
+    template <typename V = value_type, typename = typename V::second_type>
+    key_type& key() const noexcept {
+      return const_cast<key_type&>(KeyOfValue()(node_->data));
+    }
+
+    template <typename V = value_type>
+    typename V::second_type& mapped() const noexcept {
+      return node_->data.second;
+    }
+
+    allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+   private:
+    friend class RedBlackTree;
+
+    node_type(Node* node, void* ticket, const pool_allocator& alloc) noexcept
+        : node_(node), ticket_(ticket), alloc_(alloc) {}
+
+    void Reset() noexcept {
+      if (node_) {
+        node_->~Node();
+        if constexpr (kArena)
+          pool_type::deallocate_detached(alloc_, node_);
+        else
+          pool_type::release_detached(alloc_, ticket_);
+        node_ = nullptr;
+      }
+    }
+
+    Node* node_ = nullptr;
+    // What the pool gave for the node in detach().
+    void* ticket_ = nullptr;
+    pool_allocator alloc_;
+  };
+
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
   };
 
  public:
   using iterator = iterator;
   using const_iterator = const iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = const reverse_iterator;
+  using node_type = node_type;
+  using insert_return_type = insert_return_type;
+
+  RedBlackTree() noexcept : compare_() { ResetHeader(); }
+  explicit RedBlackTree(const Compare& compare,
+                        const Allocator& alloc = Allocator())
+      : compare_(compare), pool_(alloc) {
+    ResetHeader();
+  }
+
+  // Copies other node for node, colors and counts included, in one O(n)
+  // walk without comparing a single key.
+  RedBlackTree(const RedBlackTree& other, const Allocator& alloc)
+      : compare_(other.compare_), pool_(alloc) {
+    ResetHeader();
+    CloneFrom(other, [](NodeBase* node) -> const key_value& {
+      return ValueOf(node);
+    });
+  }
+
+  RedBlackTree(const RedBlackTree& other)
+      : RedBlackTree(other, std::allocator_traits<Allocator>::
+                                select_on_container_copy_construction(
+                                    other.get_allocator())) {}
+
+  // Builds the copy before letting go of the old contents, so a throwing
+  // element copy leaves this tree as it was. The allocator of other comes
+  // along only when it propagates on copy assignment.
+  RedBlackTree& operator=(const RedBlackTree& other) {
+    if (this != &other) {
+      RedBlackTree copy(
+          other, alloc_traits::propagate_on_container_copy_assignment::value
+                     ? other.get_allocator()
+                     : get_allocator());
+      swap(copy);
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value &&
+                    !alloc_traits::propagate_on_container_swap::value)
+        pool_.swap_allocator(copy.pool_);
+    }
+    return *this;
+  }
+
+  // Steals other's nodes together with its allocator, in O(1).
+  RedBlackTree(RedBlackTree&& other) noexcept
+      : compare_(other.compare_),
+        pool_(allocator_type(other.pool_.get_allocator())) {
+    ResetHeader();
+    TakeNodes(other);
+  }
+
+  // O(1) when the allocator propagates or the two compare equal, which is
+  // always the case for std::allocator. Otherwise this tree's allocator is
+  // kept and the elements are moved into nodes of its own, in the same
+  // shape. other is left empty either way.
+  RedBlackTree& operator=(RedBlackTree&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this == &other) return *this;
+
+    DestroyTree();
+    compare_ = other.compare_;
+    if (alloc_traits::propagate_on_container_move_assignment::value ||
+        pool_.get_allocator() == other.pool_.get_allocator()) {
+      TakeNodes(other);
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                        value &&
+                    !alloc_traits::propagate_on_container_swap::value)
+        pool_.swap_allocator(other.pool_);
+    } else {
+      CloneFrom(other, [](NodeBase* node) -> key_value&& {
+        return std::move(ValueOf(node));
+      });
+      other.DestroyTree();
+    }
+    return *this;
+  }
+
+  ~RedBlackTree() noexcept { DestroyTree(); }
 
-  RedBlackTree() noexcept : root_(nullptr) {}
-  ~RedBlackTree() noexcept { DestroyTree(root_); }
+  iterator begin() const noexcept { return iterator(Header()->left()); }
+  iterator end() const noexcept { return iterator(Header()); }
 
-  iterator begin() const noexcept { return iterator(Minimum(root_)); }
-  iterator end() const noexcept { return iterator(nullptr); }
+  reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
 
-  bool empty() const noexcept { return root_ == nullptr; }
-  size_t size() const noexcept { return size(root_); }
+  bool empty() const noexcept { return Header()->parent() == nullptr; }
+  size_t size() const noexcept { return count_; }
   size_t max_size() const noexcept {
+    if constexpr (kArena) return pool_type::kMaxCapacity - 1;
     return std::numeric_limits<size_t>::max() / sizeof(Node);
   }
 
-  void clear() noexcept {
-    clear(root_);
-    root_ = nullptr;
+  void clear() noexcept { DestroyTree(); }
+
+  std::pair<iterator, bool> insert(const key_value& value) {
+    return try_emplace(KeyOfValue()(value), value);
+  }
+
+  std::pair<iterator, bool> insert(key_value&& value) {
+    return try_emplace(KeyOfValue()(value), std::move(value));
   }
 
-  std::pair<iterator, bool> insert(key_value value) noexcept {
-    if (!root_) {
-      root_ = new Node{value, nullptr, nullptr, nullptr, BLACK};
-      return {iterator(root_), true};
+  // Builds the element in its node from args, then links it in after one
+  // descent, or destroys it again if its key is already present.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    NodeBase* anchor = nullptr;
+    NodeBase* new_node = CreateNodeNear(anchor, std::forward<Args>(args)...);
+    auto [parent, absent] = FindParent(KeyOf(new_node));
+    if (!absent) {
+      DestroyNode(new_node);
+      return {iterator(parent), false};
     }
 
-    Node* new_node = new Node{value, nullptr, nullptr, nullptr, RED};
-    Node* parent = nullptr;
-    Node* current = root_;
+    LinkNode(new_node, parent);
+    return {iterator(new_node), true};
+  }
+
+  // Like emplace, but descends by key first and builds the element only
+  // when key is absent. args must build an element whose key is key.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+    auto [parent, absent] = FindParent(key);
+    if (!absent) return {iterator(parent), false};
+
+    NodeBase* new_node = CreateNodeNear(parent, std::forward<Args>(args)...);
+    LinkNode(new_node, parent);
+    return {iterator(new_node), true};
+  }
+
+  // Inserts value as close as possible before hint. When the value belongs
+  // right next to hint, which is the case for the iterator the previous
+  // insertion returned in a sorted or reverse-sorted stream, or for end()
+  // with ascending keys, no search from the root is needed.
+  iterator insert(iterator hint, const key_value& value) {
+    auto [parent, absent] = FindHintParent(hint.current_, KeyOfValue()(value));
+    if (!absent) return iterator(parent);
+
+    NodeBase* new_node = CreateNodeNear(parent, value);
+    LinkNode(new_node, parent);
+    return iterator(new_node);
+  }
+
+  // Builds the element from args first, since its key is needed to place
+  // it, and destroys it again when the key is already present.
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args) {
+    NodeBase* new_node =
+        CreateNodeNear(hint.current_, std::forward<Args>(args)...);
+    auto [parent, absent] = FindHintParent(hint.current_, KeyOf(new_node));
+    if (!absent) {
+      DestroyNode(new_node);
+      return iterator(parent);
+    }
+
+    LinkNode(new_node, parent);
+    return iterator(new_node);
+  }
+
+  // Links the element of node into the tree unless its key is already
+  // there, in which case node is handed back in the result. When the
+  // allocators compare equal the node itself is linked in, and a node from
+  // another tree keeps its slab borrowed from then on; otherwise, and
+  // always for an arena, the element is moved into a node of this tree.
+  insert_return_type insert(node_type&& node) {
+    if (node.empty()) return {end(), false, node_type()};
+
+    auto [parent, absent] = FindParent(KeyOf(node.node_));
+    if (!absent) return {iterator(parent), false, std::move(node)};
+
+    NodeBase* linked = nullptr;
+    if constexpr (!kArena) {
+      if (pool_.get_allocator() == node.alloc_) {
+        pool_.attach(node.ticket_);
+        linked = std::exchange(node.node_, nullptr);
+      }
+    }
+    if constexpr (kArena || !std::allocator_traits<
+                                Allocator>::is_always_equal::value) {
+      if (!linked) {
+        linked = CreateNodeNear(parent, std::move(node.node_->data));
+        node.Reset();
+      }
+    }
+    LinkNode(linked, parent);
+    return {iterator(linked), true, node_type()};
+  }
+
+  iterator find(const key_type& key) const noexcept {
+    return MakeIterator(FindNode(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const noexcept {
+    return MakeIterator(FindNode(key));
+  }
+
+  // Writes find() of every key in [first, last) to out, in order, and
+  // returns the end of the output. The descents run kBatchWidth at a time
+  // in lockstep, each prefetching the node it steps to before the others
+  // take their turn, so their cache misses overlap instead of queueing up.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return FindBatch(first, last, out, [this](NodeBase* node) {
+      return MakeIterator(node);
+    });
+  }
+
+  // Like find_batch, but writes whether each key is present.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_batch(ForwardIt first, ForwardIt last,
+                          OutputIt out) const {
+    return FindBatch(first, last, out,
+                     [](NodeBase* node) { return node != nullptr; });
+  }
+
+  size_t erase(const key_type& key) noexcept {
+    NodeBase* node = FindNode(key);
+
+    if (!node) return 0;
+    EraseNode(node);
+    return 1;
+  }
+
+  void erase(iterator pos) noexcept {
+    if (pos.current_ != Header()) EraseNode(pos.current_);
+  }
+
+  // Unlinks the node at pos and hands it over to a node handle as it is, in
+  // O(log n). Until the node is destroyed or linked into a tree again, the
+  // handle keeps the whole slab the node was carved from, up to 4096 nodes,
+  // even once this tree is gone; a tree that takes in a node from another
+  // tree's slab keeps that slab until it is cleared. An arena tree moves the
+  // element into storage of the handle's own instead, which allocates.
+  node_type extract(iterator pos) noexcept(!kArena) {
+    NodeBase* node = pos.current_;
+    if (node == Header()) return node_type();
+
+    if constexpr (kArena) {
+      void* memory = pool_.allocate_detached();
+      Count(&Counters::allocations);
+      Node* detached;
+      try {
+        detached = new (memory) Node{{}, std::move(ValueOf(node))};
+      } catch (...) {
+        pool_allocator alloc = pool_.get_allocator();
+        pool_type::deallocate_detached(alloc, memory);
+        throw;
+      }
+      EraseNode(node);
+      return node_type(detached, nullptr, pool_.get_allocator());
+    } else {
+      UnlinkNode(node);
+      return node_type(static_cast<Node*>(node), pool_.detach(node),
+                       pool_.get_allocator());
+    }
+  }
+
+  node_type extract(const key_type& key) noexcept(!kArena) {
+    return extract(find(key));
+  }
+
+  // Moves the elements of other whose keys are not in this tree over to it;
+  // the others stay in other. Nodes are relinked rather than copied: one by
+  // one when other is small, otherwise by rebuilding both trees from a merge
+  // walk. This tree then takes over other's slabs, and only the elements
+  // left behind are moved into fresh nodes of other. Trees whose allocators
+  // differ, and arena trees, whose nodes cannot change arenas, move each
+  // element into a new node instead.
+  void merge(RedBlackTree& other) {
+    if (&other == this || !other.Header()->parent()) return;
+    if constexpr (kArena) {
+      MergeByMoving(other);
+    } else if (!(pool_.get_allocator() == other.pool_.get_allocator())) {
+      MergeByMoving(other);
+    } else {
+      MergeByRelinking(other);
+    }
+  }
+
+  // Replaces the contents with [first, last), which must be sorted by key;
+  // elements equivalent to the one before them are skipped. The tree is
+  // built balanced and colored in one pass, without rotations, from nodes
+  // carved out of a single slab. Throws std::invalid_argument and leaves the
+  // tree untouched when the input is not sorted.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    if (!assign_if_sorted(first, last))
+      throw std::invalid_argument("assign_sorted: input is not sorted");
+  }
+
+  // Like assign_sorted, but reports unsorted input by returning false.
+  template <typename InputIt>
+  bool assign_if_sorted(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+      return AssignSorted(first, last, [](const InputIt& it) -> decltype(auto) {
+        return *it;
+      });
+    } else {
+      s21::vector<key_value> buffer;
+      for (; first != last; ++first) buffer.push_back(*first);
+      return assign_if_sorted(buffer.data(), buffer.data() + buffer.size());
+    }
+  }
+
+  // Sorts a copy of the element addresses on up to threads threads (all
+  // hardware threads when 0) and builds from them as assign_sorted does. Of
+  // equivalent elements the first one in [first, last) is kept.
+  template <typename ForwardIt>
+  void assign_parallel(ForwardIt first, ForwardIt last, unsigned threads = 0) {
+    s21::vector<const key_value*> order;
+    order.reserve(static_cast<size_t>(std::distance(first, last)));
+    for (; first != last; ++first) order.push_back(&*first);
+
+    const key_value** begin = order.data();
+    ParallelSort(begin, begin + order.size(),
+                 [this](const key_value* lhs, const key_value* rhs) {
+                   return Less(KeyOfValue()(*lhs), KeyOfValue()(*rhs));
+                 },
+                 threads);
+    AssignSorted(begin, begin + order.size(),
+                 [](const key_value* const* it) -> const key_value& {
+                   return **it;
+                 });
+  }
+
+  // Replace the contents with the union, intersection, difference or
+  // symmetric difference of lhs and rhs, neither of which may be this tree.
+  // Where both hold an equivalent element the one from lhs is kept.
+  void assign_union(const RedBlackTree& lhs, const RedBlackTree& rhs) {
+    AssignSetOperation(lhs, rhs, kLhsOnly | kBoth | kRhsOnly);
+  }
+
+  void assign_intersection(const RedBlackTree& lhs, const RedBlackTree& rhs) {
+    AssignSetOperation(lhs, rhs, kBoth);
+  }
+
+  void assign_difference(const RedBlackTree& lhs, const RedBlackTree& rhs) {
+    AssignSetOperation(lhs, rhs, kLhsOnly);
+  }
+
+  void assign_symmetric_difference(const RedBlackTree& lhs,
+                                   const RedBlackTree& rhs) {
+    AssignSetOperation(lhs, rhs, kLhsOnly | kRhsOnly);
+  }
+
+  // The first element whose key is not less than key.
+  iterator lower_bound(const key_type& key) const noexcept {
+    return MakeIterator(LowerBound(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) const noexcept {
+    return MakeIterator(LowerBound(key));
+  }
+
+  // The first element whose key is greater than key.
+  iterator upper_bound(const key_type& key) const noexcept {
+    return MakeIterator(UpperBound(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key) const noexcept {
+    return MakeIterator(UpperBound(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(
+      const key_type& key) const noexcept {
+    return EqualRange(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key) const noexcept {
+    return EqualRange(key);
+  }
+
+  // Returns the element with the given zero-based position in sorted order,
+  // or end() when there are not that many elements.
+  iterator nth(size_t index) const noexcept {
+    static_assert(kRanked, "nth() needs ranked_layout");
+    NodeBase* current = Header()->parent();
 
     while (current) {
-      parent = current;
-      if (value < current->data) {
-        current = current->left;
-      } else if (current->data < value) {
-        current = current->right;
+      size_t left_size = Size(current->left());
+      if (index < left_size) {
+        current = current->left();
+      } else if (index > left_size) {
+        index -= left_size + 1;
+        current = current->right();
       } else {
-        delete new_node;
-        return {iterator(current), false};
+        break;
       }
     }
 
-    new_node->parent = parent;
-    if (value < parent->data)
-      parent->left = new_node;
-    else
-      parent->right = new_node;
+    return MakeIterator(current);
+  }
 
-    InsertFixup(new_node);
-    return {iterator(new_node), true};
+  // Returns the number of elements whose keys are less than key.
+  size_t rank(const key_type& key) const noexcept { return Rank(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_t rank(const K& key) const noexcept {
+    return Rank(key);
   }
 
-  void erase(key_value value) noexcept {
-    Node* node = FindNode(value);
+  // Arena trees keep their headers in their arenas, which trade places
+  // with the rest of the pool.
+  void swap(RedBlackTree& other) noexcept {
+    if constexpr (kArena) {
+      std::swap(count_, other.count_);
+    } else {
+      NodeBase* root = Header()->parent();
+      NodeBase* leftmost = Header()->left();
+      NodeBase* rightmost = Header()->right();
+      size_t count = count_;
+      SetRoot(other.Header()->parent(), other.count_, other.Header()->left(),
+              other.Header()->right());
+      other.SetRoot(root, count, leftmost, rightmost);
+    }
+    std::swap(compare_, other.compare_);
+    pool_.swap(other.pool_);
+  }
 
-    if (!node) return;
+  bool contains(const key_type& key) const noexcept {
+    return FindNode(key) != nullptr;
+  }
 
-    Node* to_delete = node;
-    Color to_delete_original_color = to_delete->color;
-    Node* replacement = nullptr;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const noexcept {
+    return FindNode(key) != nullptr;
+  }
 
-    if (!node->left) {
-      replacement = node->right;
-      Transplant(node, node->right);
-    } else if (!node->right) {
-      replacement = node->left;
-      Transplant(node, node->left);
-    } else {
-      to_delete = Minimum(node->right);
-      to_delete_original_color = to_delete->color;
-      replacement = to_delete->right;
+  // Counts of the tree's work, read in O(1). Needs counting_stats. The
+  // counts belong to the tree object and are not copied, moved or swapped
+  // along with its contents. The height is not among them: rotations and
+  // erasures would keep a running count from staying exact, so height()
+  // measures it afresh instead.
+  tree_stats stats() const noexcept {
+    static_assert(kCounting, "stats() needs counting_stats");
+    tree_stats result;
+    result.comparisons = counters_.comparisons.load(std::memory_order_relaxed);
+    result.left_rotations =
+        counters_.left_rotations.load(std::memory_order_relaxed);
+    result.right_rotations =
+        counters_.right_rotations.load(std::memory_order_relaxed);
+    result.insert_fixups =
+        counters_.insert_fixups.load(std::memory_order_relaxed);
+    result.delete_fixups =
+        counters_.delete_fixups.load(std::memory_order_relaxed);
+    result.allocations = counters_.allocations.load(std::memory_order_relaxed);
+    return result;
+  }
 
-      if (to_delete->parent == node) {
-        if (replacement) {
-          replacement->parent = to_delete;
-        }
+  // The number of nodes on the longest path down from the root. Nothing
+  // keeps it up to date, so every call walks the whole tree in O(n) time;
+  // read it once after a batch of changes, not on every one. Needs
+  // counting_stats.
+  size_t height() const noexcept {
+    static_assert(kCounting, "height() needs counting_stats");
+    return MeasureHeight();
+  }
+
+  // Makes room for count elements in all, so that inserting up to that many
+  // allocates nothing and, in an arena, moves no node nor any iterator.
+  void reserve(size_t count) {
+    if (count > size()) ReserveNodes(count - size());
+  }
+
+  key_compare key_comp() const { return compare_; }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(pool_.get_allocator());
+  }
+
+ private:
+  // The header is the root's parent and the node end() points at. Its left
+  // and right hold the first and last nodes, so begin(), --end() and hints
+  // at either end need no descent; in an empty tree they point back at the
+  // header. It is the only red node whose grandparent is itself. Arena
+  // links cannot reach outside their arena, so an arena tree keeps its
+  // header in the first slot and uses this one only until it has an arena.
+  NodeBase header_;
+  Compare compare_;
+  mutable counters_type counters_;
+  pool_type pool_;
+  // The number of nodes, which compact nodes have no subtree count for.
+  size_t count_ = 0;
+
+  NodeBase* Header() const noexcept {
+    if constexpr (kArena) {
+      if (pool_.data()) return static_cast<NodeBase*>(pool_.data());
+    }
+    return const_cast<NodeBase*>(&header_);
+  }
+
+  void ResetHeader() noexcept {
+    Header()->set_parent(nullptr);
+    Header()->set_left(Header());
+    Header()->set_right(Header());
+    Header()->set_color(RED);
+    count_ = 0;
+  }
+
+  // Hangs root, a subtree of count nodes whose first and last are leftmost
+  // and rightmost, under the header; those two are looked up when not given.
+  void SetRoot(NodeBase* root, size_t count, NodeBase* leftmost = nullptr,
+               NodeBase* rightmost = nullptr) noexcept {
+    if (!root) {
+      ResetHeader();
+      return;
+    }
+
+    Header()->set_parent(root);
+    root->set_parent(Header());
+    Header()->set_left(leftmost ? leftmost : Minimum(root));
+    Header()->set_right(rightmost ? rightmost : Maximum(root));
+    count_ = count;
+  }
+
+  void Count(std::atomic<size_t> Counters::*counter) const noexcept {
+    if constexpr (kCounting) {
+      std::atomic<size_t>& count = counters_.*counter;
+      count.store(count.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+    }
+  }
+
+  // Every key comparison goes through here, so that it can be counted.
+  template <typename A, typename B>
+  bool Less(const A& lhs, const B& rhs) const {
+    Count(&Counters::comparisons);
+    return compare_(lhs, rhs);
+  }
+
+  // The number of nodes on the longest path down from the root, found by a
+  // walk that climbs back through parent links instead of keeping a stack.
+  size_t MeasureHeight() const noexcept {
+    size_t height = 0, depth = 1;
+    NodeBase* from = Header();
+    NodeBase* node = Header()->parent();
+    while (node && node != Header()) {
+      NodeBase* next;
+      if (from == node->parent()) {
+        if (depth > height) height = depth;
+        next = node->left() ? node->left()
+               : node->right() ? node->right()
+                               : node->parent();
+      } else if (from == node->left() && node->right()) {
+        next = node->right();
       } else {
-        Transplant(to_delete, to_delete->right);
-        to_delete->right = node->right;
-        if (node->right) {
-          node->right->parent = to_delete;
+        next = node->parent();
+      }
+      depth = next == node->parent() ? depth - 1 : depth + 1;
+      from = node;
+      node = next;
+    }
+    return height;
+  }
+
+  iterator MakeIterator(NodeBase* node) const noexcept {
+    return iterator(node ? node : Header());
+  }
+
+  static key_value& ValueOf(NodeBase* node) noexcept {
+    return static_cast<Node*>(node)->data;
+  }
+
+  static const key_type& KeyOf(const NodeBase* node) noexcept {
+    return KeyOfValue()(static_cast<const Node*>(node)->data);
+  }
+
+  // Which elements of a set operation to keep: those only in lhs, those in
+  // both (taken from lhs) and those only in rhs.
+  enum SetParts : unsigned { kLhsOnly = 1, kBoth = 2, kRhsOnly = 4 };
+
+  // Collects the kept nodes in order and builds from them as assign_sorted
+  // does. Usually that is one merge walk over both trees, but when the parts
+  // to keep never include the larger side's own elements and the smaller
+  // side is short enough that a search per element beats walking the larger
+  // one, only the smaller side is walked.
+  void AssignSetOperation(const RedBlackTree& lhs, const RedBlackTree& rhs,
+                          unsigned parts) {
+    size_t lhs_size = lhs.size(), rhs_size = rhs.size();
+    bool lhs_small = lhs_size <= rhs_size;
+    size_t small_size = lhs_small ? lhs_size : rhs_size;
+    size_t large_size = lhs_small ? rhs_size : lhs_size;
+    s21::vector<const NodeBase*> kept;
+    if (small_size * Height(large_size) < large_size &&
+        !(parts & (lhs_small ? kRhsOnly : kLhsOnly))) {
+      const RedBlackTree& small = lhs_small ? lhs : rhs;
+      const RedBlackTree& large = lhs_small ? rhs : lhs;
+      for (NodeBase* node = small.Header()->left(); node != small.Header();
+           node = Next(node)) {
+        const NodeBase* match = large.FindNode(KeyOf(node));
+        if (match && (parts & kBoth))
+          kept.push_back(lhs_small ? node : match);
+        else if (!match && (parts & (kLhsOnly | kRhsOnly)))
+          kept.push_back(node);
+      }
+    } else {
+      NodeBase* left = lhs.Header()->left();
+      NodeBase* right = rhs.Header()->left();
+      while (left != lhs.Header() && right != rhs.Header()) {
+        if (Less(KeyOf(left), KeyOf(right))) {
+          if (parts & kLhsOnly) kept.push_back(left);
+          left = Next(left);
+        } else if (Less(KeyOf(right), KeyOf(left))) {
+          if (parts & kRhsOnly) kept.push_back(right);
+          right = Next(right);
+        } else {
+          if (parts & kBoth) kept.push_back(left);
+          left = Next(left);
+          right = Next(right);
         }
       }
+      for (; left != lhs.Header() && (parts & kLhsOnly); left = Next(left))
+        kept.push_back(left);
+      for (; right != rhs.Header() && (parts & kRhsOnly); right = Next(right))
+        kept.push_back(right);
+    }
 
-      Transplant(node, to_delete);
-      to_delete->left = node->left;
-      to_delete->left->parent = to_delete;
-      to_delete->color = node->color;
+    const NodeBase** begin = kept.data();
+    AssignSorted(begin, begin + kept.size(),
+                 [](const NodeBase* const* it) -> const key_value& {
+                   return static_cast<const Node*>(*it)->data;
+                 });
+  }
+
+  template <typename ForwardIt, typename Get>
+  bool AssignSorted(ForwardIt first, ForwardIt last, Get get) {
+    size_t count = 0;
+
+    // get may return a converted temporary, so keys are never held on to.
+    auto less = [&](const ForwardIt& lhs, const ForwardIt& rhs) {
+      return Less(KeyOfValue()(get(lhs)), KeyOfValue()(get(rhs)));
+    };
+    for (ForwardIt prev = first, it = first; it != last; prev = it, ++it) {
+      if (it == first || less(prev, it))
+        ++count;
+      else if (less(it, prev))
+        return false;
     }
 
-    delete node;
+    DestroyTree();
+    ReserveNodes(count);
 
-    if (to_delete_original_color == BLACK)
-      DeleteFixup(replacement, to_delete->parent);
+    NodeBase* last_built = nullptr;
+    SetRoot(BuildSubtree(first, get, count, 0, RedDepth(count), last_built),
+            count);
+    return true;
   }
 
-  void swap(RedBlackTree& other) noexcept { std::swap(root_, other.root_); }
+  template <typename ForwardIt, typename Get>
+  NodeBase* BuildSubtree(ForwardIt& it, Get& get, size_t count, size_t depth,
+                         size_t red_depth, NodeBase*& last_built) {
+    if (count == 0) return nullptr;
+
+    size_t left_count = (count - 1) / 2;
+    NodeBase* left =
+        BuildSubtree(it, get, left_count, depth + 1, red_depth, last_built);
+
+    while (last_built &&
+           !Less(KeyOf(last_built), KeyOfValue()(get(it))))
+      ++it;
+
+    NodeBase* node;
+    try {
+      node = CreateNode(get(it));
+    } catch (...) {
+      DestroySubtree(left);
+      throw;
+    }
+    ++it;
+    last_built = node;
+
+    node->set_color(depth == red_depth ? RED : BLACK);
+    SetSize(node, count);
+    node->set_left(left);
+    if (left) left->set_parent(node);
+
+    try {
+      node->set_right(BuildSubtree(it, get, count - left_count - 1,
+                                   depth + 1, red_depth, last_built));
+    } catch (...) {
+      DestroySubtree(node);
+      throw;
+    }
+    if (node->right()) node->right()->set_parent(node);
+
+    return node;
+  }
 
-  bool contains(key_value value) const noexcept {
-    Node* current = root_;
+  template <typename K>
+  NodeBase* LowerBound(const K& key) const noexcept {
+    NodeBase* result = nullptr;
+    NodeBase* current = Header()->parent();
 
     while (current) {
-      if (value == current->data) {
-        return true;
-      } else if (value < current->data) {
-        current = current->left;
+      if (Less(KeyOf(current), key)) {
+        current = current->right();
       } else {
-        current = current->right;
+        result = current;
+        current = current->left();
       }
     }
 
-    return false;
+    return result;
   }
 
- private:
-  Node* root_;
+  template <typename K>
+  NodeBase* UpperBound(const K& key) const noexcept {
+    NodeBase* result = nullptr;
+    NodeBase* current = Header()->parent();
 
-  Node* FindNode(const key_value& value) const {
-    Node* current = root_;
+    while (current) {
+      if (Less(key, KeyOf(current))) {
+        result = current;
+        current = current->left();
+      } else {
+        current = current->right();
+      }
+    }
+
+    return result;
+  }
+
+  // Keys are unique, so the range holds at most the lower bound itself.
+  template <typename K>
+  std::pair<iterator, iterator> EqualRange(const K& key) const noexcept {
+    iterator first = MakeIterator(LowerBound(key));
+    iterator last = first;
+
+    if (first != end() && !Less(key, KeyOf(first.current_))) ++last;
+    return {first, last};
+  }
+
+  template <typename K>
+  size_t Rank(const K& key) const noexcept {
+    static_assert(kRanked, "rank() needs ranked_layout");
+    size_t result = 0;
+    NodeBase* current = Header()->parent();
 
     while (current) {
-      if (value == current->data) {
-        return current;
-      } else if (value < current->data) {
-        current = current->left;
+      if (Less(KeyOf(current), key)) {
+        result += Size(current->left()) + 1;
+        current = current->right();
+      } else {
+        current = current->left();
+      }
+    }
+
+    return result;
+  }
+
+  template <typename K>
+  NodeBase* FindNode(const K& key) const noexcept {
+    NodeBase* current = Header()->parent();
+
+    while (current) {
+      if (Less(key, KeyOf(current))) {
+        current = current->left();
+      } else if (Less(KeyOf(current), key)) {
+        current = current->right();
       } else {
-        current = current->right;
+        return current;
       }
     }
 
     return nullptr;
   }
 
-  void DestroyTree(Node* node) noexcept {
-    if (node) {
-      DestroyTree(node->left);
-      DestroyTree(node->right);
-      delete node;
+  // Descents in flight at once in find_batch(), about as many cache misses
+  // as a core keeps outstanding.
+  static constexpr size_t kBatchWidth = 16;
+  // Below this many bytes of nodes the tree stays in cache, nothing is
+  // waiting on memory, and the bookkeeping of the lockstep only costs time.
+  static constexpr size_t kBatchMinBytes = size_t(1) << 21;
+
+  template <typename ForwardIt, typename OutputIt, typename Emit>
+  OutputIt FindBatch(ForwardIt first, ForwardIt last, OutputIt out,
+                     Emit emit) const {
+    if (size() * sizeof(Node) < kBatchMinBytes) {
+      for (; first != last; ++first, ++out) *out = emit(FindNode(*first));
+      return out;
+    }
+
+    using key_reference = decltype(*first);
+    using key_pointer = std::remove_reference_t<key_reference>*;
+    key_pointer keys[kBatchWidth];
+    NodeBase* current[kBatchWidth];
+    NodeBase* found[kBatchWidth];
+
+    while (first != last) {
+      size_t width = 0;
+      for (; width < kBatchWidth && first != last; ++width, ++first) {
+        keys[width] = &*first;
+        current[width] = Header()->parent();
+        found[width] = nullptr;
+      }
+
+      for (bool active = true; active;) {
+        active = false;
+        for (size_t i = 0; i < width; ++i) {
+          NodeBase* node = current[i];
+          if (!node) continue;
+          if (Less(*keys[i], KeyOf(node))) {
+            node = node->left();
+          } else if (Less(KeyOf(node), *keys[i])) {
+            node = node->right();
+          } else {
+            found[i] = node;
+            node = nullptr;
+          }
+          if (node) {
+            __builtin_prefetch(node);
+            active = true;
+          }
+          current[i] = node;
+        }
+      }
+
+      for (size_t i = 0; i < width; ++i, ++out) *out = emit(found[i]);
+    }
+    return out;
+  }
+
+  void EraseNode(NodeBase* node) noexcept {
+    UnlinkNode(node);
+    DestroyNode(node);
+  }
+
+  // Takes node out of the tree, rebalancing it, without destroying node.
+  void UnlinkNode(NodeBase* node) noexcept {
+    if (node == Header()->right())
+      Header()->set_right(node == Header()->left() ? Header() : Prev(node));
+    if (node == Header()->left()) Header()->set_left(Next(node));
+
+    NodeBase* to_delete = node;
+    Color to_delete_original_color = to_delete->color();
+    NodeBase* replacement = nullptr;
+    NodeBase* replacement_parent = node->parent();
+
+    if (!node->left()) {
+      replacement = node->right();
+      Transplant(node, node->right());
+    } else if (!node->right()) {
+      replacement = node->left();
+      Transplant(node, node->left());
+    } else {
+      to_delete = Minimum(node->right());
+      to_delete_original_color = to_delete->color();
+      replacement = to_delete->right();
+
+      if (to_delete->parent() == node) {
+        replacement_parent = to_delete;
+        if (replacement) {
+          replacement->set_parent(to_delete);
+        }
+      } else {
+        replacement_parent = to_delete->parent();
+        Transplant(to_delete, to_delete->right());
+        to_delete->set_right(node->right());
+        if (node->right()) {
+          node->right()->set_parent(to_delete);
+        }
+      }
+
+      Transplant(node, to_delete);
+      to_delete->set_left(node->left());
+      to_delete->left()->set_parent(to_delete);
+      to_delete->set_color(node->color());
+    }
+
+    --count_;
+    if constexpr (kRanked) {
+      for (NodeBase* current = replacement_parent; current != Header();
+           current = current->parent())
+        UpdateSize(current);
     }
+
+    if (to_delete_original_color == BLACK)
+      DeleteFixup(replacement, replacement_parent);
   }
 
-  size_t size(Node* node) const noexcept {
-    if (node == nullptr) return 0;
+  // The key's position: the node holding it and false, or the parent to
+  // link a new node under and true.
+  template <typename K>
+  std::pair<NodeBase*, bool> FindParent(const K& key) const noexcept {
+    NodeBase* parent = nullptr;
+    NodeBase* current = Header()->parent();
 
-    size_t left_size = size(node->left);
-    size_t right_size = size(node->right);
+    while (current) {
+      parent = current;
+      if (Less(key, KeyOf(current)))
+        current = current->left();
+      else if (Less(KeyOf(current), key))
+        current = current->right();
+      else
+        return {current, false};
+    }
 
-    return left_size + right_size + 1;
+    return {parent, true};
   }
 
-  void clear(Node* node) noexcept {
-    if (node == nullptr) return;
-    clear(node->left);
-    clear(node->right);
-    delete node;
+  // Where key goes given a hint, checked against the hint and its neighbor
+  // before falling back to FindParent(). Same result pair as FindParent().
+  template <typename K>
+  std::pair<NodeBase*, bool> FindHintParent(NodeBase* hint,
+                                            const K& key) const noexcept {
+    if (hint == Header()) {
+      if (Header()->parent() && Less(KeyOf(Header()->right()), key))
+        return {Header()->right(), true};
+    } else if (Less(key, KeyOf(hint))) {
+      if (hint == Header()->left()) return {hint, true};
+      NodeBase* before = Prev(hint);
+      if (Less(KeyOf(before), key))
+        return {before->right() ? hint : before, true};
+    } else if (Less(KeyOf(hint), key)) {
+      if (hint == Header()->right()) return {hint, true};
+      NodeBase* after = Next(hint);
+      if (Less(key, KeyOf(after)))
+        return {hint->right() ? after : hint, true};
+    } else {
+      return {hint, false};
+    }
+
+    return FindParent(key);
   }
 
-  void RotateLeft(Node* node) noexcept {
-    if (!node || !node->right) return;
+  // Links node under parent, or makes it the root when parent is null.
+  void LinkNode(NodeBase* node, NodeBase* parent) noexcept {
+    node->set_parent(parent ? parent : Header());
+    node->set_left(nullptr);
+    node->set_right(nullptr);
+    node->set_color(RED);
+    SetSize(node, 1);
+
+    if (!parent) {
+      Header()->set_parent(node);
+      Header()->set_left(node);
+      Header()->set_right(node);
+    } else if (Less(KeyOf(node), KeyOf(parent))) {
+      parent->set_left(node);
+      if (parent == Header()->left()) Header()->set_left(node);
+    } else {
+      parent->set_right(node);
+      if (parent == Header()->right()) Header()->set_right(node);
+    }
 
-    Node* right_child = node->right;
-    node->right = right_child->left;
+    ++count_;
+    if constexpr (kRanked) {
+      for (NodeBase* current = node->parent(); current != Header();
+           current = current->parent())
+        ++current->size;
+    }
+    InsertFixup(node);
+  }
 
-    if (right_child->left) right_child->left->parent = node;
+  // Rebuilds a balanced tree out of nodes already sorted by key, the same
+  // shape assign_sorted builds, and returns its root for SetRoot().
+  static NodeBase* RelinkSorted(s21::vector<NodeBase*>& nodes) noexcept {
+    return RelinkSubtree(nodes.data(), nodes.size(), 0,
+                         RedDepth(nodes.size()));
+  }
 
-    right_child->parent = node->parent;
+  static NodeBase* RelinkSubtree(NodeBase* const* nodes, size_t count,
+                                 size_t depth, size_t red_depth) noexcept {
+    if (count == 0) return nullptr;
+
+    size_t left_count = (count - 1) / 2;
+    NodeBase* node = nodes[left_count];
+    node->set_left(RelinkSubtree(nodes, left_count, depth + 1, red_depth));
+    node->set_right(RelinkSubtree(nodes + left_count + 1,
+                                  count - left_count - 1, depth + 1,
+                                  red_depth));
+    if (node->left()) node->left()->set_parent(node);
+    if (node->right()) node->right()->set_parent(node);
+    node->set_color(depth == red_depth ? RED : BLACK);
+    SetSize(node, count);
+    return node;
+  }
 
-    if (!node->parent) {
-      root_ = right_child;
-    } else if (node == node->parent->left) {
-      node->parent->left = right_child;
+  // After owner absorbed this tree's slabs, moves every element into a
+  // fresh node of this tree's own pool and frees the old nodes to owner.
+  void MigrateNodes(pool_type& owner) {
+    s21::vector<NodeBase*> old_nodes;
+    old_nodes.reserve(size());
+    for (NodeBase* node = Header()->left(); node != Header(); node = Next(node))
+      old_nodes.push_back(node);
+    ResetHeader();
+
+    auto free_old = [&] {
+      for (NodeBase* node : old_nodes) {
+        static_cast<Node*>(node)->~Node();
+        owner.deallocate(node);
+      }
+    };
+    try {
+      NodeBase* const* first = old_nodes.data();
+      AssignSorted(first, first + old_nodes.size(),
+                   [](NodeBase* const* it) -> key_value&& {
+                     return std::move(ValueOf(*it));
+                   });
+    } catch (...) {
+      free_old();
+      throw;
+    }
+    free_old();
+  }
+
+  // Copies the shape of other into this empty tree, each element built from
+  // get(node) of its counterpart. The walk follows other's parent links back
+  // up, so it needs no stack however deep the tree; a node whose children
+  // are both copied is finished. A throwing element copy destroys what was
+  // built so far.
+  template <typename Get>
+  void CloneFrom(const RedBlackTree& other, Get get) {
+    NodeBase* source = other.Header()->parent();
+    if (!source) return;
+    if constexpr (kArena && kTriviallyCopyable) {
+      pool_.copy(other.pool_);
+      count_ = other.count_;
+      return;
+    }
+
+    ReserveNodes(other.size());
+    try {
+      NodeBase* copy = CloneNode(source, Header(), get);
+      Header()->set_parent(copy);
+      while (true) {
+        if (source->left() && !copy->left()) {
+          source = source->left();
+          copy->set_left(CloneNode(source, copy, get));
+          copy = copy->left();
+        } else if (source->right() && !copy->right()) {
+          source = source->right();
+          copy->set_right(CloneNode(source, copy, get));
+          copy = copy->right();
+        } else if (source != other.Header()->parent()) {
+          source = source->parent();
+          copy = copy->parent();
+        } else {
+          break;
+        }
+      }
+    } catch (...) {
+      DestroyTree();
+      throw;
+    }
+    SetRoot(Header()->parent(), other.count_);
+  }
+
+  template <typename Get>
+  NodeBase* CloneNode(NodeBase* source, NodeBase* parent, Get& get) {
+    NodeBase* copy = CreateNode(get(source));
+    copy->set_parent(parent);
+    copy->set_color(source->color());
+    if constexpr (kRanked) copy->size = source->size;
+    return copy;
+  }
+
+  // Takes over other's nodes and slabs in O(1), leaving other empty. This
+  // tree must be empty, without an arena, and its allocator equal to
+  // other's.
+  void TakeNodes(RedBlackTree& other) noexcept {
+    if constexpr (kArena) {
+      count_ = std::exchange(other.count_, 0);
     } else {
-      node->parent->right = right_child;
+      SetRoot(other.Header()->parent(), other.count_, other.Header()->left(),
+              other.Header()->right());
+      other.ResetHeader();
     }
+    pool_.swap(other.pool_);
+  }
 
-    right_child->left = node;
-    node->parent = right_child;
+  // merge() for trees whose pools can share nodes.
+  void MergeByRelinking(RedBlackTree& other) {
+    size_t moved = 0;
+    if (other.size() * Height(size()) < size()) {
+      for (NodeBase *node = other.Header()->left(), *next;
+           node != other.Header(); node = next) {
+        next = Next(node);
+        auto [parent, absent] = FindParent(KeyOf(node));
+        if (absent) {
+          other.UnlinkNode(node);
+          LinkNode(node, parent);
+          ++moved;
+        }
+      }
+    } else {
+      s21::vector<NodeBase*> kept, left_behind;
+      kept.reserve(size() + other.size());
+      NodeBase* mine = Header()->left();
+      NodeBase* theirs = other.Header()->left();
+      while (mine != Header() || theirs != other.Header()) {
+        if (theirs == other.Header() ||
+            (mine != Header() && Less(KeyOf(mine), KeyOf(theirs)))) {
+          kept.push_back(mine);
+          mine = Next(mine);
+        } else if (mine == Header() || Less(KeyOf(theirs), KeyOf(mine))) {
+          kept.push_back(theirs);
+          theirs = Next(theirs);
+          ++moved;
+        } else {
+          kept.push_back(mine);
+          left_behind.push_back(theirs);
+          mine = Next(mine);
+          theirs = Next(theirs);
+        }
+      }
+      if (moved != 0) {
+        SetRoot(RelinkSorted(kept), kept.size());
+        other.SetRoot(RelinkSorted(left_behind), left_behind.size());
+      }
+    }
+    if (moved == 0) return;
+
+    pool_.absorb(other.pool_);
+    if (other.Header()->parent()) other.MigrateNodes(pool_);
   }
 
-  void RotateRight(Node* node) noexcept {
-    if (!node || !node->left) return;
+  // merge() for trees whose pools cannot share nodes.
+  void MergeByMoving(RedBlackTree& other) {
+    for (NodeBase *node = other.Header()->left(), *next;
+         node != other.Header(); node = next) {
+      next = Next(node);
+      auto [parent, absent] = FindParent(KeyOf(node));
+      if (absent) {
+        NodeBase* moved = CreateNodeNear(parent, std::move(ValueOf(node)));
+        LinkNode(moved, parent);
+        other.EraseNode(node);
+      }
+    }
+  }
 
-    Node* left_child = node->left;
-    node->left = left_child->right;
+  // The node is left unlinked; LinkNode() sets its links.
+  template <typename... Args>
+  Node* CreateNode(Args&&... args) {
+    void* memory = pool_.allocate();
+    Count(&Counters::allocations);
+
+    try {
+      return new (memory) Node{{}, key_value(std::forward<Args>(args)...)};
+    } catch (...) {
+      pool_.deallocate(memory);
+      throw;
+    }
+  }
 
-    if (left_child->right) left_child->right->parent = node;
+  // CreateNode() for a node to be linked next to anchor, which is updated
+  // should the arena have to grow and move. The element is built before
+  // that, since args may refer to an element in the arena.
+  template <typename... Args>
+  Node* CreateNodeNear(NodeBase*& anchor, Args&&... args) {
+    if constexpr (kArena) {
+      if (pool_.available() == 0) {
+        key_value value(std::forward<Args>(args)...);
+        size_t index = anchor && pool_.data() ? pool_.index_of(anchor) : 0;
+        ReserveNodes(1);
+        if (anchor) anchor = static_cast<NodeBase*>(pool_.slot(index));
+        return CreateNode(std::move(value));
+      }
+    }
+    return CreateNode(std::forward<Args>(args)...);
+  }
 
-    left_child->parent = node->parent;
+  // Makes sure count more nodes can be created without growing the pool.
+  // An arena that has to grow moves, taking every node with it, so no
+  // NodeBase* from before is valid afterwards. Its first slot goes to the
+  // header.
+  void ReserveNodes(size_t count) {
+    if constexpr (kArena) {
+      if (count == 0) return;
+      bool fresh = !pool_.data();
+      pool_.reserve(count + fresh, [this](void* from, void* to, size_t used) {
+        RelocateNodes(from, to, used);
+      });
+      if (fresh) {
+        new (pool_.allocate()) NodeBase();
+        ResetHeader();
+      }
+    } else {
+      pool_.reserve(count);
+    }
+  }
 
-    if (!node->parent) {
-      root_ = left_child;
-    } else if (node == node->parent->left) {
-      node->parent->left = left_child;
+  // Element types an arena may copy byte for byte.
+  static constexpr bool kTriviallyCopyable =
+      std::is_trivially_copy_constructible<key_value>::value &&
+      std::is_trivially_destructible<key_value>::value;
+
+  // Moves the header and every node from the used arena slots at from to
+  // the same slots at to. Offsets between slots do not change, so the links
+  // are copied as they are. A throwing element copy leaves from untouched.
+  void RelocateNodes(void* from, void* to, size_t used) {
+    if constexpr (kTriviallyCopyable) {
+      std::memcpy(to, from, used * sizeof(Node));
     } else {
-      node->parent->right = left_child;
+      NodeBase* header = static_cast<NodeBase*>(from);
+      auto target = [from, to](NodeBase* node) {
+        return static_cast<Node*>(to) +
+               (static_cast<Node*>(node) - static_cast<Node*>(from));
+      };
+
+      new (to) NodeBase(*header);
+      NodeBase* node = header->left();
+      try {
+        for (; node != header; node = Next(node))
+          new (target(node))
+              Node{NodeBase(*node), std::move_if_noexcept(ValueOf(node))};
+      } catch (...) {
+        for (NodeBase* built = header->left(); built != node;
+             built = Next(built))
+          target(built)->~Node();
+        throw;
+      }
+      DestroyValues(header->parent());
     }
+  }
 
-    left_child->right = node;
-    node->parent = left_child;
+  void DestroyNode(NodeBase* node) noexcept {
+    static_cast<Node*>(node)->~Node();
+    pool_.deallocate(node);
   }
 
-  void InsertFixup(Node* node) noexcept {
-    while (node != root_ && node->parent && node->parent->color == RED) {
-      if (node->parent == node->parent->parent->left) {
-        Node* uncle = node->parent->parent->right;
+  // Nodes are not returned to the pool one by one: once the values are
+  // destroyed every slab is released at once, and trivially destructible
+  // values skip the walk entirely.
+  void DestroyTree() noexcept {
+    if (!std::is_trivially_destructible<key_value>::value)
+      DestroyValues(Header()->parent());
+    ResetHeader();
+    pool_.release();
+  }
+
+  void DestroySubtree(NodeBase* root) noexcept {
+    ForEachPostOrder(root, [this](NodeBase* node) { DestroyNode(node); });
+  }
 
-        if (uncle && uncle->color == RED) {
-          node->parent->color = BLACK;
-          uncle->color = BLACK;
-          node->parent->parent->color = RED;
-          node = node->parent->parent;
+  static void DestroyValues(NodeBase* root) noexcept {
+    ForEachPostOrder(root,
+                     [](NodeBase* node) { static_cast<Node*>(node)->~Node(); });
+  }
+
+  // Hands every node of the subtree at root to visit after its children,
+  // without recursion or a stack: the walk climbs back through parent links
+  // and cuts each node off its parent first, so visit may destroy it and
+  // the links it leaves behind are not meaningful.
+  template <typename Visit>
+  static void ForEachPostOrder(NodeBase* root, Visit visit) noexcept {
+    NodeBase* node = root;
+    while (node) {
+      if (node->left()) {
+        node = node->left();
+      } else if (node->right()) {
+        node = node->right();
+      } else {
+        NodeBase* parent = node == root ? nullptr : node->parent();
+        if (parent && parent->left() == node)
+          parent->set_left(nullptr);
+        else if (parent)
+          parent->set_right(nullptr);
+        visit(node);
+        node = parent;
+      }
+    }
+  }
+
+  // A balanced tree of count nodes has full levels above this depth; the
+  // partial level below them is red, which gives every path the same number
+  // of black nodes.
+  static size_t RedDepth(size_t count) noexcept {
+    size_t red_depth = 0;
+    while ((size_t{2} << red_depth) - 1 <= count) ++red_depth;
+    return red_depth;
+  }
+
+  // The number of bits in count, roughly the height of a tree that size.
+  static size_t Height(size_t count) noexcept {
+    size_t height = 1;
+    while (count >> height) ++height;
+    return height;
+  }
+
+  // Subtree counts are kept by ranked_layout only; for compact nodes the
+  // setters do nothing.
+  static size_t Size(const NodeBase* node) noexcept {
+    return node ? node->size : 0;
+  }
+
+  static void SetSize(NodeBase* node, size_t size) noexcept {
+    if constexpr (kRanked) node->size = size;
+  }
+
+  static void UpdateSize(NodeBase* node) noexcept {
+    if constexpr (kRanked)
+      node->size = Size(node->left()) + Size(node->right()) + 1;
+  }
+
+  void RotateLeft(NodeBase* node) noexcept {
+    if (!node || !node->right()) return;
+
+    Count(&Counters::left_rotations);
+    NodeBase* right_child = node->right();
+    node->set_right(right_child->left());
+
+    if (right_child->left()) right_child->left()->set_parent(node);
+
+    right_child->set_parent(node->parent());
+
+    if (node->parent() == Header()) {
+      Header()->set_parent(right_child);
+    } else if (node == node->parent()->left()) {
+      node->parent()->set_left(right_child);
+    } else {
+      node->parent()->set_right(right_child);
+    }
+
+    right_child->set_left(node);
+    node->set_parent(right_child);
+
+    if constexpr (kRanked) {
+      right_child->size = node->size;
+      UpdateSize(node);
+    }
+  }
+
+  void RotateRight(NodeBase* node) noexcept {
+    if (!node || !node->left()) return;
+
+    Count(&Counters::right_rotations);
+    NodeBase* left_child = node->left();
+    node->set_left(left_child->right());
+
+    if (left_child->right()) left_child->right()->set_parent(node);
+
+    left_child->set_parent(node->parent());
+
+    if (node->parent() == Header()) {
+      Header()->set_parent(left_child);
+    } else if (node == node->parent()->left()) {
+      node->parent()->set_left(left_child);
+    } else {
+      node->parent()->set_right(left_child);
+    }
+
+    left_child->set_right(node);
+    node->set_parent(left_child);
+
+    if constexpr (kRanked) {
+      left_child->size = node->size;
+      UpdateSize(node);
+    }
+  }
+
+  void InsertFixup(NodeBase* node) noexcept {
+    while (node != Header()->parent() && node->parent()->color() == RED) {
+      Count(&Counters::insert_fixups);
+      if (node->parent() == node->parent()->parent()->left()) {
+        NodeBase* uncle = node->parent()->parent()->right();
+
+        if (uncle && uncle->color() == RED) {
+          node->parent()->set_color(BLACK);
+          uncle->set_color(BLACK);
+          node->parent()->parent()->set_color(RED);
+          node = node->parent()->parent();
         } else {
-          if (node == node->parent->right) {
-            node = node->parent;
+          if (node == node->parent()->right()) {
+            node = node->parent();
             RotateLeft(node);
           }
 
-          node->parent->color = BLACK;
-          node->parent->parent->color = RED;
-          RotateRight(node->parent->parent);
+          node->parent()->set_color(BLACK);
+          node->parent()->parent()->set_color(RED);
+          RotateRight(node->parent()->parent());
         }
       } else {
-        Node* uncle = node->parent->parent->left;
+        NodeBase* uncle = node->parent()->parent()->left();
 
-        if (uncle && uncle->color == RED) {
-          node->parent->color = BLACK;
-          uncle->color = BLACK;
-          node->parent->parent->color = RED;
-          node = node->parent->parent;
+        if (uncle && uncle->color() == RED) {
+          node->parent()->set_color(BLACK);
+          uncle->set_color(BLACK);
+          node->parent()->parent()->set_color(RED);
+          node = node->parent()->parent();
         } else {
-          if (node == node->parent->left) {
-            node = node->parent;
+          if (node == node->parent()->left()) {
+            node = node->parent();
             RotateRight(node);
           }
 
-          node->parent->color = BLACK;
-          node->parent->parent->color = RED;
-          RotateLeft(node->parent->parent);
+          node->parent()->set_color(BLACK);
+          node->parent()->parent()->set_color(RED);
+          RotateLeft(node->parent()->parent());
         }
       }
     }
 
-    root_->color = BLACK;
+    Header()->parent()->set_color(BLACK);
   }
 
-  void DeleteFixup(Node* node, Node* parent) noexcept {
-    Node* sibling;
+  void DeleteFixup(NodeBase* node, NodeBase* parent) noexcept {
+    NodeBase* sibling;
 
-    while (node != root_ && (node == nullptr || node->color == BLACK)) {
-      if (node == parent->left) {
-        sibling = parent->right;
+    while (node != Header()->parent() && (!node || node->color() == BLACK)) {
+      Count(&Counters::delete_fixups);
+      if (node == parent->left()) {
+        sibling = parent->right();
 
-        if (sibling && sibling->color == RED) {
-          sibling->color = BLACK;
-          parent->color = RED;
+        if (sibling->color() == RED) {
+          sibling->set_color(BLACK);
+          parent->set_color(RED);
           RotateLeft(parent);
-          sibling = parent->right;
+          sibling = parent->right();
         }
 
-        if ((!sibling->left || sibling->left->color == BLACK) &&
-            (!sibling->right || sibling->right->color == BLACK)) {
-          sibling->color = RED;
+        if ((!sibling->left() || sibling->left()->color() == BLACK) &&
+            (!sibling->right() || sibling->right()->color() == BLACK)) {
+          sibling->set_color(RED);
           node = parent;
+          parent = node->parent();
         } else {
-          if (!sibling->right || sibling->right->color == BLACK) {
-            if (sibling->left) {
-              sibling->left->color = BLACK;
-            }
-            sibling->color = RED;
+          if (!sibling->right() || sibling->right()->color() == BLACK) {
+            sibling->left()->set_color(BLACK);
+            sibling->set_color(RED);
             RotateRight(sibling);
-            sibling = parent->right;
+            sibling = parent->right();
           }
 
-          sibling->color = parent->color;
-          parent->color = BLACK;
-          if (sibling->right) {
-            sibling->right->color = BLACK;
-          }
+          sibling->set_color(parent->color());
+          parent->set_color(BLACK);
+          if (sibling->right()) sibling->right()->set_color(BLACK);
           RotateLeft(parent);
-          node = root_;
+          node = Header()->parent();
         }
       } else {
-        sibling = parent->left;
+        sibling = parent->left();
 
-        if (sibling && sibling->color == RED) {
-          sibling->color = BLACK;
-          parent->color = RED;
+        if (sibling->color() == RED) {
+          sibling->set_color(BLACK);
+          parent->set_color(RED);
           RotateRight(parent);
-          sibling = parent->left;
+          sibling = parent->left();
         }
 
-        if ((!sibling->right || sibling->right->color == BLACK) &&
-            (!sibling->left || sibling->left->color == BLACK)) {
-          sibling->color = RED;
+        if ((!sibling->right() || sibling->right()->color() == BLACK) &&
+            (!sibling->left() || sibling->left()->color() == BLACK)) {
+          sibling->set_color(RED);
           node = parent;
+          parent = node->parent();
         } else {
-          if (!sibling->left || sibling->left->color == BLACK) {
-            if (sibling->right) {
-              sibling->right->color = BLACK;
-            }
-            sibling->color = RED;
+          if (!sibling->left() || sibling->left()->color() == BLACK) {
+            sibling->right()->set_color(BLACK);
+            sibling->set_color(RED);
             RotateLeft(sibling);
-            sibling = parent->left;
+            sibling = parent->left();
           }
 
-          sibling->color = parent->color;
-          parent->color = BLACK;
-          if (sibling->left) {
-            sibling->left->color = BLACK;
-          }
+          sibling->set_color(parent->color());
+          parent->set_color(BLACK);
+          if (sibling->left()) sibling->left()->set_color(BLACK);
           RotateRight(parent);
-          node = root_;
+          node = Header()->parent();
         }
       }
-
-      if (node) node->color = BLACK;
     }
+
+    if (node) node->set_color(BLACK);
   }
 
-  void Transplant(Node* u, Node* v) noexcept {
-    if (!u->parent) {
-      root_ = v;
-    } else if (u == u->parent->left) {
-      u->parent->left = v;
+  void Transplant(NodeBase* u, NodeBase* v) noexcept {
+    if (u->parent() == Header()) {
+      Header()->set_parent(v);
+    } else if (u == u->parent()->left()) {
+      u->parent()->set_left(v);
     } else {
-      u->parent->right = v;
+      u->parent()->set_right(v);
     }
 
-    if (v) v->parent = u->parent;
+    if (v) v->set_parent(u->parent());
+  }
+
+  static NodeBase* Minimum(NodeBase* node) noexcept {
+    while (node && node->left()) node = node->left();
+    return node;
   }
 
-  static Node* Minimum(Node* node) noexcept {
-    while (node && node->left) node = node->left;
+  static NodeBase* Maximum(NodeBase* node) noexcept {
+    while (node && node->right()) node = node->right();
     return node;
   }
+
+  // The in-order predecessor of node. The header precedes nothing but
+  // steps back to the last node; it is told apart from the root, whose
+  // parent it is, by being red.
+  static NodeBase* Prev(NodeBase* node) noexcept {
+    if (node->color() == RED && node->parent() &&
+        node->parent()->parent() == node)
+      return node->right();
+    if (node->left()) return Maximum(node->left());
+
+    NodeBase* parent = node->parent();
+    while (node == parent->left()) {
+      node = parent;
+      parent = parent->parent();
+    }
+    return parent;
+  }
+
+  // The in-order successor of node, or the header after the last one.
+  static NodeBase* Next(NodeBase* node) noexcept {
+    if (node->right()) return Minimum(node->right());
+
+    NodeBase* parent = node->parent();
+    while (node == parent->right()) {
+      node = parent;
+      parent = parent->parent();
+    }
+    // Climbing out of the root reaches the header, whose right link points
+    // back down at the last node.
+    return node->right() != parent ? parent : node;
+  }
 };
 }  // namespace s21
 
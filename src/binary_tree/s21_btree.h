@@ -0,0 +1,816 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_key_of_value.h"
+
+namespace s21 {
+// A B-tree ordered like RedBlackTree, by Compare over the key KeyOfValue
+// extracts. Each node holds up to kSlots values side by side in about four
+// cache lines, so a lookup visits log_kSlots(n) nodes instead of log2(n)
+// and a scan reads whole nodes in order. Values are moved as nodes fill
+// and drain, so unlike the red-black tree every insert and erase
+// invalidates all iterators, and values must be nothrow move constructible
+// for the tree to stay intact when an allocation fails.
+template <typename T, typename Key = T, typename KeyOfValue = Identity<T>,
+          typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<T>>
+class BTree {
+ public:
+  using key_value = T;
+  using key_type = Key;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+ private:
+  using slot_type = typename MutableSlot<T>::type;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static constexpr size_t kNodeBytes = 256;
+  static constexpr size_t kHeaderBytes = sizeof(void*) + 3;
+  static constexpr size_t kSlots = std::max<size_t>(
+      3,
+      std::min<size_t>(255, (kNodeBytes - kHeaderBytes) / sizeof(slot_type)));
+  // Every node but the root keeps at least this many values after an erase.
+  static constexpr size_t kMinSlots = kSlots / 2;
+
+  struct InternalNode;
+
+  struct LeafNode {
+    LeafNode() noexcept {}
+    ~LeafNode() noexcept {}
+
+    InternalNode* parent = nullptr;
+    unsigned char position = 0;  // Among the children of parent.
+    unsigned char count = 0;
+    bool leaf = true;
+    union {
+      slot_type slots[kSlots];
+    };
+  };
+
+  // The child at i holds the values ordered before slots[i].
+  struct InternalNode : LeafNode {
+    InternalNode() noexcept { this->leaf = false; }
+
+    LeafNode* children[kSlots + 1];
+  };
+
+  using leaf_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<LeafNode>;
+  using internal_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<InternalNode>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = key_value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = key_value*;
+    using reference = key_value&;
+
+    iterator() noexcept = default;
+
+    iterator& operator++() noexcept {
+      Increment();
+      return *this;
+    }
+
+    iterator operator++(int) noexcept {
+      iterator old = *this;
+      Increment();
+      return old;
+    }
+
+    // Stepping back from end() reaches the last element.
+    iterator& operator--() noexcept {
+      Decrement();
+      return *this;
+    }
+
+    iterator operator--(int) noexcept {
+      iterator old = *this;
+      Decrement();
+      return old;
+    }
+
+    key_value& operator*() const noexcept {
+      return ValueOf(node_, position_);
+    }
+    key_value* operator->() const noexcept {
+      return &ValueOf(node_, position_);
+    }
+
+    bool operator==(const iterator& other) const noexcept {
+      return node_ == other.node_ && position_ == other.position_;
+    }
+
+    bool operator!=(const iterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class BTree;
+
+    iterator(LeafNode* node, size_t position) noexcept
+        : node_(node), position_(position) {}
+
+    void Increment() noexcept {
+      if (!node_->leaf) {
+        node_ = Child(node_, position_ + 1);
+        while (!node_->leaf) node_ = Child(node_, 0);
+        position_ = 0;
+        return;
+      }
+      if (++position_ < node_->count) return;
+
+      // Past the last value of a leaf: the next one is in the first
+      // ancestor entered from the left. Past the last leaf there is none,
+      // and the iterator stays one past that leaf's values, at end().
+      LeafNode* node = node_;
+      size_t position = position_;
+      while (position == node->count && node->parent) {
+        position = node->position;
+        node = node->parent;
+      }
+      if (position < node->count) {
+        node_ = node;
+        position_ = position;
+      }
+    }
+
+    void Decrement() noexcept {
+      if (!node_->leaf) {
+        node_ = Child(node_, position_);
+        while (!node_->leaf) node_ = Child(node_, node_->count);
+        position_ = node_->count - 1;
+        return;
+      }
+      if (position_ > 0) {
+        --position_;
+        return;
+      }
+
+      LeafNode* node = node_;
+      size_t position = 0;
+      while (position == 0 && node->parent) {
+        position = node->position;
+        node = node->parent;
+      }
+      if (position > 0) {
+        node_ = node;
+        position_ = position - 1;
+      }
+    }
+
+    LeafNode* node_ = nullptr;
+    size_t position_ = 0;
+  };
+
+  using const_iterator = const iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = const reverse_iterator;
+
+  BTree() noexcept(noexcept(Compare()) && noexcept(Allocator())) = default;
+  explicit BTree(const Compare& compare, const Allocator& alloc = Allocator())
+      : compare_(compare), alloc_(alloc) {}
+  // Takes the nodes of other along with its allocator, so they are still
+  // freed through the one that allocated them.
+  BTree(BTree&& other) noexcept
+      : root_(std::exchange(other.root_, nullptr)),
+        leftmost_(std::exchange(other.leftmost_, nullptr)),
+        rightmost_(std::exchange(other.rightmost_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        compare_(other.compare_),
+        alloc_(std::move(other.alloc_)) {}
+
+  BTree(const BTree&) = delete;
+
+  // Copies other into a tree of its own and swaps that in, so this tree is
+  // left as it was should copying throw. The allocator of other comes along
+  // only when it propagates on copy assignment.
+  BTree& operator=(const BTree& other) {
+    if (this == &other) return *this;
+
+    BTree copy(other.compare_,
+               alloc_traits::propagate_on_container_copy_assignment::value
+                   ? other.alloc_
+                   : alloc_);
+    copy.assign_sorted(other.begin(), other.end());
+    swap(copy);
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value &&
+                  !alloc_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, copy.alloc_);
+    return *this;
+  }
+
+  // O(1) when the allocator propagates or the two compare equal. Otherwise
+  // the nodes of other cannot be adopted, so its elements move one by one,
+  // in order, into packed nodes from this tree's allocator. other is left
+  // empty.
+  BTree& operator=(BTree&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this == &other) return *this;
+
+    clear();
+    compare_ = other.compare_;
+    if (alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_ == other.alloc_) {
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                        value)
+        alloc_ = std::move(other.alloc_);
+      root_ = std::exchange(other.root_, nullptr);
+      leftmost_ = std::exchange(other.leftmost_, nullptr);
+      rightmost_ = std::exchange(other.rightmost_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    } else {
+      for (iterator it = other.begin(); it != other.end(); ++it)
+        InsertAt(rightmost_, end().position_,
+                 std::move(it.node_->slots[it.position_]));
+      other.clear();
+    }
+    return *this;
+  }
+
+  ~BTree() noexcept { clear(); }
+
+  // The last leaf is the only one end() can point into, one past its values.
+  iterator begin() const noexcept {
+    return root_ ? iterator(leftmost_, 0) : iterator();
+  }
+  iterator end() const noexcept {
+    return root_ ? iterator(rightmost_, rightmost_->count) : iterator();
+  }
+
+  reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_t size() const noexcept { return size_; }
+  size_t max_size() const noexcept {
+    return std::numeric_limits<size_t>::max() / sizeof(slot_type);
+  }
+
+  void clear() noexcept {
+    if (root_) DestroySubtree(root_);
+    root_ = leftmost_ = rightmost_ = nullptr;
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(const key_value& value) {
+    return try_emplace(KeyOfValue()(value), value);
+  }
+
+  std::pair<iterator, bool> insert(key_value&& value) {
+    return try_emplace(KeyOfValue()(value), std::move(value));
+  }
+
+  // The value is built before the search, which needs its key.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    slot_type value(std::forward<Args>(args)...);
+    return try_emplace(KeyOf(value), std::move(value));
+  }
+
+  // Builds the value from args only when key is not present yet.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+    if (!root_)
+      return {InsertAt(nullptr, 0, std::forward<Args>(args)...), true};
+
+    LeafNode* node = root_;
+    size_t position;
+    for (;;) {
+      position = LowerBoundIn(node, key);
+      if (position < node->count && !compare_(key, KeyOf(node, position)))
+        return {iterator(node, position), false};
+      if (node->leaf) break;
+      node = Child(node, position);
+    }
+
+    return {InsertAt(node, position, std::forward<Args>(args)...), true};
+  }
+
+  // Only a hint at end() is used: appending past the last key goes straight
+  // to the last leaf, which is what copying and sorted input do. Any other
+  // hint costs a descent, as without one.
+  iterator insert(iterator hint, const key_value& value) {
+    if (hint == end() && After(KeyOfValue()(value)))
+      return InsertAt(rightmost_, end().position_, value);
+    return try_emplace(KeyOfValue()(value), value).first;
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args) {
+    slot_type value(std::forward<Args>(args)...);
+    if (hint == end() && After(KeyOf(value)))
+      return InsertAt(rightmost_, end().position_, std::move(value));
+    return try_emplace(KeyOf(value), std::move(value)).first;
+  }
+
+  iterator find(const key_type& key) const noexcept { return Find(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const noexcept {
+    return Find(key);
+  }
+
+  bool contains(const key_type& key) const noexcept {
+    return Find(key) != end();
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const noexcept {
+    return Find(key) != end();
+  }
+
+  iterator lower_bound(const key_type& key) const noexcept {
+    return LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) const noexcept {
+    return LowerBound(key);
+  }
+
+  iterator upper_bound(const key_type& key) const noexcept {
+    return UpperBound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key) const noexcept {
+    return UpperBound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(
+      const key_type& key) const noexcept {
+    return EqualRange(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key) const noexcept {
+    return EqualRange(key);
+  }
+
+  // A value in an internal node is replaced by its predecessor, which always
+  // sits at the end of a leaf, so values are only ever removed from leaves.
+  void erase(iterator pos) noexcept {
+    LeafNode* node = pos.node_;
+    size_t position = pos.position_;
+    if (!node || position >= node->count) return;
+
+    DestroySlot(node, position);
+    if (!node->leaf) {
+      iterator before = pos;
+      --before;
+      Relocate(&node->slots[position], &before.node_->slots[before.position_]);
+      node = before.node_;
+    } else {
+      for (size_t i = position + 1; i < node->count; ++i)
+        Relocate(&node->slots[i - 1], &node->slots[i]);
+    }
+    --node->count;
+    --size_;
+    Rebalance(node);
+  }
+
+  size_t erase(const key_type& key) noexcept {
+    iterator it = Find(key);
+    if (it == end()) return 0;
+    erase(it);
+    return 1;
+  }
+
+  // Replaces the contents with [first, last), which must be sorted by key;
+  // elements equivalent to the one before them are skipped. Every value is
+  // appended to the last leaf, and splits there leave the full half behind,
+  // so the nodes come out packed. Throws std::invalid_argument and leaves
+  // the tree untouched when the input is not sorted.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    BTree built(compare_, alloc_);
+    for (; first != last; ++first) {
+      // A converted element lives as long as this reference to it.
+      const key_value& value = *first;
+      const key_type& key = KeyOfValue()(value);
+      if (built.After(key))
+        built.InsertAt(built.rightmost_, built.end().position_, value);
+      else if (compare_(key, KeyOf(built.rightmost_,
+                                   built.rightmost_->count - 1)))
+        throw std::invalid_argument("assign_sorted: input is not sorted");
+    }
+    swap(built);
+  }
+
+  // Moves the elements of other whose keys are not here yet into this tree;
+  // the rest stay in other, in order.
+  void merge(BTree& other) {
+    if (this == &other) return;
+
+    BTree left_behind(other.compare_, other.alloc_);
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      slot_type& value = it.node_->slots[it.position_];
+      if (!try_emplace(KeyOf(value), std::move(value)).second)
+        left_behind.InsertAt(left_behind.rightmost_,
+                             left_behind.end().position_, std::move(value));
+    }
+    other.swap(left_behind);
+  }
+
+  void swap(BTree& other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(leftmost_, other.leftmost_);
+    std::swap(rightmost_, other.rightmost_);
+    std::swap(size_, other.size_);
+    std::swap(compare_, other.compare_);
+    if constexpr (alloc_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, other.alloc_);
+  }
+
+  key_compare key_comp() const { return compare_; }
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+ private:
+  // Small arithmetic keys under operator< are found by counting the smaller
+  // ones in a single branch-free pass over the node, which the compiler
+  // turns into vector compares. Everything else uses a binary search.
+  template <typename K>
+  static constexpr bool kCountingSearch =
+      std::is_arithmetic<key_type>::value &&
+      std::is_same<slot_type, key_type>::value &&
+      std::is_same<K, key_type>::value &&
+      (std::is_same<Compare, std::less<key_type>>::value ||
+       std::is_same<Compare, std::less<>>::value);
+
+  LeafNode* root_ = nullptr;
+  LeafNode* leftmost_ = nullptr;
+  LeafNode* rightmost_ = nullptr;
+  size_t size_ = 0;
+  Compare compare_;
+  Allocator alloc_;
+
+  static LeafNode* Child(const LeafNode* node, size_t index) noexcept {
+    return static_cast<const InternalNode*>(node)->children[index];
+  }
+
+  static void SetChild(LeafNode* node, size_t index, LeafNode* child) noexcept {
+    static_cast<InternalNode*>(node)->children[index] = child;
+    child->parent = static_cast<InternalNode*>(node);
+    child->position = static_cast<unsigned char>(index);
+  }
+
+  // The slots of a map hold pair<Key, T>; callers see pair<const Key, T>.
+  static key_value& ValueOf(const LeafNode* node, size_t position) noexcept {
+    return *std::launder(reinterpret_cast<key_value*>(
+        const_cast<slot_type*>(&node->slots[position])));
+  }
+
+  static const key_type& KeyOf(const LeafNode* node,
+                               size_t position) noexcept {
+    return KeyOfValue()(ValueOf(node, position));
+  }
+
+  static const key_type& KeyOf(slot_type& value) noexcept {
+    return KeyOfValue()(*std::launder(reinterpret_cast<key_value*>(&value)));
+  }
+
+  // Whether key belongs after every key in the tree.
+  bool After(const key_type& key) const noexcept {
+    return !root_ || compare_(KeyOf(rightmost_, rightmost_->count - 1), key);
+  }
+
+  template <typename K>
+  size_t LowerBoundIn(const LeafNode* node, const K& key) const noexcept {
+    if constexpr (kCountingSearch<K>) {
+      size_t position = 0;
+      for (size_t i = 0; i < node->count; ++i)
+        position += node->slots[i] < key;
+      return position;
+    } else {
+      size_t first = 0, count = node->count;
+      while (count > 0) {
+        size_t half = count / 2;
+        if (compare_(KeyOf(node, first + half), key)) {
+          first += half + 1;
+          count -= half + 1;
+        } else {
+          count = half;
+        }
+      }
+      return first;
+    }
+  }
+
+  template <typename K>
+  size_t UpperBoundIn(const LeafNode* node, const K& key) const noexcept {
+    if constexpr (kCountingSearch<K>) {
+      size_t position = 0;
+      for (size_t i = 0; i < node->count; ++i)
+        position += !(key < node->slots[i]);
+      return position;
+    } else {
+      size_t first = 0, count = node->count;
+      while (count > 0) {
+        size_t half = count / 2;
+        if (!compare_(key, KeyOf(node, first + half))) {
+          first += half + 1;
+          count -= half + 1;
+        } else {
+          count = half;
+        }
+      }
+      return first;
+    }
+  }
+
+  template <typename K>
+  iterator Find(const K& key) const noexcept {
+    for (LeafNode* node = root_; node;) {
+      size_t position = LowerBoundIn(node, key);
+      if (position < node->count && !compare_(key, KeyOf(node, position)))
+        return iterator(node, position);
+      if (node->leaf) break;
+      node = Child(node, position);
+    }
+    return end();
+  }
+
+  // The deepest node on the search path with a key not less than key holds
+  // the lower bound; deeper keys on the path are all smaller.
+  template <typename K>
+  iterator LowerBound(const K& key) const noexcept {
+    iterator result = end();
+    for (LeafNode* node = root_; node;) {
+      size_t position = LowerBoundIn(node, key);
+      if (position < node->count) result = iterator(node, position);
+      if (node->leaf) break;
+      node = Child(node, position);
+    }
+    return result;
+  }
+
+  template <typename K>
+  iterator UpperBound(const K& key) const noexcept {
+    iterator result = end();
+    for (LeafNode* node = root_; node;) {
+      size_t position = UpperBoundIn(node, key);
+      if (position < node->count) result = iterator(node, position);
+      if (node->leaf) break;
+      node = Child(node, position);
+    }
+    return result;
+  }
+
+  // Keys are unique, so the range holds at most the lower bound itself.
+  template <typename K>
+  std::pair<iterator, iterator> EqualRange(const K& key) const noexcept {
+    iterator first = LowerBound(key);
+    iterator last = first;
+
+    if (first != end() && !compare_(key, KeyOfValue()(*first))) ++last;
+    return {first, last};
+  }
+
+  // Puts a value built from args at position in leaf, splitting the leaf
+  // first when it is full. A null leaf starts the tree.
+  template <typename... Args>
+  iterator InsertAt(LeafNode* leaf, size_t position, Args&&... args) {
+    if (!leaf) leaf = root_ = leftmost_ = rightmost_ = NewLeaf();
+    if (leaf->count == kSlots) Split(leaf, position);
+
+    for (size_t i = leaf->count; i > position; --i)
+      Relocate(&leaf->slots[i], &leaf->slots[i - 1]);
+    try {
+      new (&leaf->slots[position]) slot_type(std::forward<Args>(args)...);
+    } catch (...) {
+      for (size_t i = position; i < leaf->count; ++i)
+        Relocate(&leaf->slots[i], &leaf->slots[i + 1]);
+      if (!size_) clear();
+      throw;
+    }
+    ++leaf->count;
+    ++size_;
+    return iterator(leaf, position);
+  }
+
+  // Splits the full node around the slot at position, which is about to be
+  // taken, and moves the separating value up into the parent, splitting
+  // that first if it is full too. Afterwards node and position name where
+  // the new value goes. Inserting at either end of a node leaves the old
+  // half full, so ascending or descending runs pack their nodes.
+  void Split(LeafNode*& node, size_t& position) {
+    LeafNode* sibling = node->leaf ? NewLeaf() : NewInternal();
+    try {
+      if (!node->parent) {
+        LeafNode* root = NewInternal();
+        SetChild(root, 0, node);
+        root_ = root;
+      } else if (node->parent->count == kSlots) {
+        LeafNode* parent = node->parent;
+        size_t index = node->position;
+        Split(parent, index);
+      }
+    } catch (...) {
+      DeleteNode(sibling);
+      throw;
+    }
+
+    size_t count = node->count;
+    size_t middle = position == count ? count - 1
+                    : position == 0   ? 0
+                                      : count / 2;
+    for (size_t i = middle + 1; i < count; ++i)
+      Relocate(&sibling->slots[i - middle - 1], &node->slots[i]);
+    if (!node->leaf) {
+      for (size_t i = middle + 1; i <= count; ++i)
+        SetChild(sibling, i - middle - 1, Child(node, i));
+    }
+    sibling->count = static_cast<unsigned char>(count - middle - 1);
+    node->count = static_cast<unsigned char>(middle);
+
+    LeafNode* parent = node->parent;
+    size_t index = node->position;
+    for (size_t i = parent->count; i > index; --i) {
+      Relocate(&parent->slots[i], &parent->slots[i - 1]);
+      SetChild(parent, i + 1, Child(parent, i));
+    }
+    Relocate(&parent->slots[index], &node->slots[middle]);
+    SetChild(parent, index + 1, sibling);
+    ++parent->count;
+
+    if (rightmost_ == node) rightmost_ = sibling;
+    if (position > middle) {
+      node = sibling;
+      position -= middle + 1;
+    }
+  }
+
+  // Refills node, which just lost a value, from a sibling with values to
+  // spare, or else merges it with one, which takes a value from the parent
+  // and may leave that short in turn.
+  void Rebalance(LeafNode* node) noexcept {
+    while (node != root_ && node->count < kMinSlots) {
+      LeafNode* parent = node->parent;
+      size_t index = node->position;
+      LeafNode* left = index > 0 ? Child(parent, index - 1) : nullptr;
+      LeafNode* right =
+          index < parent->count ? Child(parent, index + 1) : nullptr;
+
+      if (left && left->count > kMinSlots) {
+        MoveRight(parent, index - 1);
+        return;
+      }
+      if (right && right->count > kMinSlots) {
+        MoveLeft(parent, index);
+        return;
+      }
+      Merge(parent, left ? index - 1 : index);
+      node = parent;
+    }
+
+    if (root_->count > 0) return;
+    LeafNode* old_root = root_;
+    if (old_root->leaf) {
+      root_ = leftmost_ = rightmost_ = nullptr;
+    } else {
+      root_ = Child(old_root, 0);
+      root_->parent = nullptr;
+      root_->position = 0;
+    }
+    DeleteNode(old_root);
+  }
+
+  // Moves the last value of child index through the parent into the front
+  // of child index + 1.
+  void MoveRight(LeafNode* parent, size_t index) noexcept {
+    LeafNode* left = Child(parent, index);
+    LeafNode* right = Child(parent, index + 1);
+
+    for (size_t i = right->count; i > 0; --i)
+      Relocate(&right->slots[i], &right->slots[i - 1]);
+    Relocate(&right->slots[0], &parent->slots[index]);
+    Relocate(&parent->slots[index], &left->slots[left->count - 1]);
+    if (!right->leaf) {
+      for (size_t i = right->count + 1; i > 0; --i)
+        SetChild(right, i, Child(right, i - 1));
+      SetChild(right, 0, Child(left, left->count));
+    }
+    --left->count;
+    ++right->count;
+  }
+
+  // Moves the first value of child index + 1 through the parent onto the
+  // end of child index.
+  void MoveLeft(LeafNode* parent, size_t index) noexcept {
+    LeafNode* left = Child(parent, index);
+    LeafNode* right = Child(parent, index + 1);
+
+    Relocate(&left->slots[left->count], &parent->slots[index]);
+    Relocate(&parent->slots[index], &right->slots[0]);
+    for (size_t i = 1; i < right->count; ++i)
+      Relocate(&right->slots[i - 1], &right->slots[i]);
+    if (!right->leaf) {
+      SetChild(left, left->count + 1, Child(right, 0));
+      for (size_t i = 1; i <= right->count; ++i)
+        SetChild(right, i - 1, Child(right, i));
+    }
+    ++left->count;
+    --right->count;
+  }
+
+  // Appends the separator at index and all of child index + 1 to child
+  // index, then drops both from the parent.
+  void Merge(LeafNode* parent, size_t index) noexcept {
+    LeafNode* left = Child(parent, index);
+    LeafNode* right = Child(parent, index + 1);
+    size_t start = left->count + 1;
+
+    Relocate(&left->slots[left->count], &parent->slots[index]);
+    for (size_t i = 0; i < right->count; ++i)
+      Relocate(&left->slots[start + i], &right->slots[i]);
+    if (!left->leaf) {
+      for (size_t i = 0; i <= right->count; ++i)
+        SetChild(left, start + i, Child(right, i));
+    }
+    left->count = static_cast<unsigned char>(start + right->count);
+
+    for (size_t i = index + 1; i < parent->count; ++i) {
+      Relocate(&parent->slots[i - 1], &parent->slots[i]);
+      SetChild(parent, i, Child(parent, i + 1));
+    }
+    --parent->count;
+
+    if (rightmost_ == right) rightmost_ = left;
+    right->count = 0;
+    DeleteNode(right);
+  }
+
+  static void Relocate(slot_type* to, slot_type* from) noexcept {
+    new (to) slot_type(std::move(*from));
+    from->~slot_type();
+  }
+
+  static void DestroySlot(LeafNode* node, size_t position) noexcept {
+    node->slots[position].~slot_type();
+  }
+
+  LeafNode* NewLeaf() {
+    leaf_allocator alloc(alloc_);
+    LeafNode* node = std::allocator_traits<leaf_allocator>::allocate(alloc, 1);
+    return new (node) LeafNode();
+  }
+
+  LeafNode* NewInternal() {
+    internal_allocator alloc(alloc_);
+    InternalNode* node =
+        std::allocator_traits<internal_allocator>::allocate(alloc, 1);
+    return new (node) InternalNode();
+  }
+
+  // Frees the node alone; its values must already be gone.
+  void DeleteNode(LeafNode* node) noexcept {
+    if (node->leaf) {
+      leaf_allocator alloc(alloc_);
+      node->~LeafNode();
+      std::allocator_traits<leaf_allocator>::deallocate(alloc, node, 1);
+    } else {
+      internal_allocator alloc(alloc_);
+      InternalNode* internal = static_cast<InternalNode*>(node);
+      internal->~InternalNode();
+      std::allocator_traits<internal_allocator>::deallocate(alloc, internal,
+                                                            1);
+    }
+  }
+
+  void DestroySubtree(LeafNode* node) noexcept {
+    if (!std::is_trivially_destructible<slot_type>::value) {
+      for (size_t i = 0; i < node->count; ++i) DestroySlot(node, i);
+    }
+    if (!node->leaf) {
+      for (size_t i = 0; i <= node->count; ++i)
+        DestroySubtree(Child(node, i));
+    }
+    DeleteNode(node);
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_H
@@ -0,0 +1,169 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_EPOCH_H
+#define CPP2_S21_CONTAINERS_1_S21_EPOCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+// Epoch-based reclamation for lock-free containers. A thread pins the
+// current epoch for as long as it may hold pointers to shared nodes. A node
+// that no thread can reach any more is retired in the epoch of the moment,
+// and handed back to be freed once the global epoch is two steps past it,
+// which takes every pin from that epoch or before to be released.
+//
+// Node needs a Node* retired_next member, which the reclaimer uses to chain
+// retired nodes.
+template <typename Node>
+class EpochReclaimer {
+ private:
+  struct Slot;
+
+ public:
+  // Pins an epoch for its lifetime. A copy pins the same epoch, so that a
+  // copied iterator keeps protecting the node it points to.
+  class Guard {
+   public:
+    Guard() noexcept = default;
+
+    Guard(const Guard& other) : owner_(other.owner_) {
+      if (owner_) slot_ = owner_->Claim(EpochOf(other.slot_));
+    }
+
+    Guard(Guard&& other) noexcept
+        : owner_(std::exchange(other.owner_, nullptr)), slot_(other.slot_) {}
+
+    Guard& operator=(Guard other) noexcept {
+      std::swap(owner_, other.owner_);
+      std::swap(slot_, other.slot_);
+      return *this;
+    }
+
+    ~Guard() noexcept {
+      if (owner_) slot_->state.store(0);
+    }
+
+   private:
+    friend class EpochReclaimer;
+
+    Guard(const EpochReclaimer* owner, Slot* slot) noexcept
+        : owner_(owner), slot_(slot) {}
+
+    const EpochReclaimer* owner_ = nullptr;
+    Slot* slot_ = nullptr;
+  };
+
+  EpochReclaimer() : blocks_(new Block) {}
+  EpochReclaimer(const EpochReclaimer&) = delete;
+  EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+  Guard Pin() const { return Guard(this, Claim(kCurrent)); }
+
+  // Queues node, which no thread can reach any more, and returns a chain of
+  // earlier nodes that are now safe to free. The caller must be pinned.
+  Node* Retire(Node* node) {
+    std::atomic<Node*>& list = retired_[epoch_.load() % 3];
+    node->retired_next = list.load();
+    while (!list.compare_exchange_weak(node->retired_next, node)) {
+    }
+    if (retire_count_.fetch_add(1) % kRetiresPerAdvance) return nullptr;
+    return TryAdvance();
+  }
+
+  // Every retired node, for when no thread is pinned any more.
+  Node* TakeAll() noexcept {
+    Node* all = nullptr;
+    for (std::atomic<Node*>& list : retired_) {
+      Node* node = list.exchange(nullptr);
+      while (node) {
+        Node* next = node->retired_next;
+        node->retired_next = all;
+        all = node;
+        node = next;
+      }
+    }
+    return all;
+  }
+
+ private:
+  static constexpr size_t kSlots = 128;
+  static constexpr size_t kRetiresPerAdvance = 64;
+  static constexpr uint64_t kCurrent = ~uint64_t(0);
+
+  // Zero when free, otherwise the pinned epoch shifted left over a one.
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> state{0};
+  };
+
+  // Slots come in blocks of kSlots. When every slot is taken, as when one
+  // thread holds that many iterators, another block is chained on; blocks
+  // stay until the reclaimer goes, so a slot never moves or disappears.
+  struct Block {
+    ~Block() { delete next.load(); }
+
+    Slot slots[kSlots];
+    std::atomic<Block*> next{nullptr};
+  };
+
+  static uint64_t EpochOf(const Slot* slot) noexcept {
+    return slot->state.load() >> 1;
+  }
+
+  // Takes a free slot, starting in each block from one picked by the thread
+  // id so that threads rarely race for the same one, and pins epoch in it.
+  Slot* Claim(uint64_t epoch) const {
+    size_t start = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (Block* block = blocks_.get();;) {
+      for (size_t i = 0; i < kSlots; ++i) {
+        Slot& slot = block->slots[(start + i) % kSlots];
+        if (TryPin(slot, epoch)) return &slot;
+      }
+      Block* next = block->next.load();
+      if (!next) {
+        std::unique_ptr<Block> grown(new Block);
+        if (block->next.compare_exchange_strong(next, grown.get()))
+          next = grown.release();
+      }
+      block = next;
+    }
+  }
+
+  bool TryPin(Slot& slot, uint64_t epoch) const {
+    uint64_t pinned = epoch == kCurrent ? epoch_.load() : epoch;
+    uint64_t expected = 0;
+    if (!slot.state.compare_exchange_strong(expected, pinned << 1 | 1))
+      return false;
+    // The epoch may have moved on before the pin was visible, past a scan
+    // that found the slot free; follow it until it holds still.
+    if (epoch == kCurrent) {
+      for (uint64_t now; (now = epoch_.load()) != pinned; pinned = now)
+        slot.state.store(now << 1 | 1);
+    }
+    return true;
+  }
+
+  // Moves the epoch on when every pinned thread has seen the current one,
+  // and returns what was retired two epochs before the new one.
+  Node* TryAdvance() {
+    uint64_t epoch = epoch_.load();
+    for (Block* block = blocks_.get(); block; block = block->next.load()) {
+      for (const Slot& slot : block->slots) {
+        uint64_t state = slot.state.load();
+        if ((state & 1) && (state >> 1) != epoch) return nullptr;
+      }
+    }
+    if (!epoch_.compare_exchange_strong(epoch, epoch + 1)) return nullptr;
+    return retired_[(epoch + 2) % 3].exchange(nullptr);
+  }
+
+  std::unique_ptr<Block> blocks_;
+  mutable std::atomic<uint64_t> epoch_{0};
+  std::atomic<Node*> retired_[3] = {};
+  std::atomic<size_t> retire_count_{0};
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_EPOCH_H
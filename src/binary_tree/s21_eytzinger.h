@@ -0,0 +1,252 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_EYTZINGER_H
+#define CPP2_S21_CONTAINERS_1_S21_EYTZINGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+// A read-only search index over sorted, unique keys. The keys stay in one
+// sorted array cut into blocks of a cache line each, and the last key of
+// every block goes into a complete binary tree laid out in breadth-first
+// (Eytzinger) order: node k has its children at 2k and 2k + 1. A lookup
+// descends that tree with one comparison per level and no branch on its
+// outcome, prefetching the line that holds the node's descendants a few
+// levels further down, so the misses of consecutive levels overlap. The
+// tree then names the one block that can hold the key, and the keys of
+// that block are counted against it at once, with SSE2 for int keys.
+//
+// The tree is padded to a perfect one with copies of the last key, which
+// lets the position of a node in sorted order be computed instead of
+// stored.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+class EytzingerIndex {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  // Whether the keys can move without moving them one by one.
+  static constexpr bool kNothrowMove =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+ public:
+  using key_type = Key;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using container_type = s21::vector<key_type, allocator_type>;
+  using size_type = std::size_t;
+
+  EytzingerIndex() = default;
+
+  explicit EytzingerIndex(const key_compare& compare,
+                          const allocator_type& alloc = allocator_type())
+      : keys_(alloc), separators_(alloc), compare_(compare) {}
+
+  // keys must be sorted and unique under compare.
+  EytzingerIndex(container_type&& keys, const key_compare& compare)
+      : keys_(std::move(keys)),
+        separators_(keys_.get_allocator()),
+        compare_(compare) {
+    Build();
+  }
+
+  EytzingerIndex(const EytzingerIndex& other) = default;
+  EytzingerIndex(EytzingerIndex&& other) noexcept = default;
+  ~EytzingerIndex() noexcept = default;
+
+  // Should copying throw, the index is left empty.
+  EytzingerIndex& operator=(const EytzingerIndex& other) {
+    if (this != &other) {
+      try {
+        keys_ = other.keys_;
+        separators_ = other.separators_;
+      } catch (...) {
+        clear();
+        throw;
+      }
+      compare_ = other.compare_;
+      height_ = other.height_;
+    }
+    return *this;
+  }
+
+  // Moves the keys one by one, which allocates, when the allocator does not
+  // propagate and the two compare unequal; should that throw, both indexes
+  // are left empty.
+  EytzingerIndex& operator=(EytzingerIndex&& other) noexcept(kNothrowMove) {
+    if (this != &other) {
+      if constexpr (kNothrowMove) {
+        keys_ = std::move(other.keys_);
+        separators_ = std::move(other.separators_);
+      } else {
+        try {
+          keys_ = std::move(other.keys_);
+          separators_ = std::move(other.separators_);
+        } catch (...) {
+          clear();
+          other.clear();
+          throw;
+        }
+      }
+      compare_ = std::move(other.compare_);
+      height_ = std::exchange(other.height_, 0);
+    }
+    return *this;
+  }
+
+  const key_type* keys() const noexcept { return keys_.data(); }
+  size_type size() const noexcept { return keys_.size(); }
+  key_compare key_comp() const { return compare_; }
+  allocator_type get_allocator() const noexcept {
+    return keys_.get_allocator();
+  }
+
+  void clear() noexcept {
+    keys_.clear();
+    separators_.clear();
+    height_ = 0;
+  }
+
+  void swap(EytzingerIndex& other) noexcept {
+    keys_.swap(other.keys_);
+    separators_.swap(other.separators_);
+    std::swap(compare_, other.compare_);
+    std::swap(height_, other.height_);
+  }
+
+  // The position of the first key not less than key, or size().
+  template <typename K>
+  size_type LowerBound(const K& key) const noexcept {
+    size_type count = keys_.size();
+    if (count == 0) return count;
+
+    const key_type* separators = separators_.data();
+    size_type node = 1;
+    for (size_type level = 0; level < height_; ++level) {
+      __builtin_prefetch(separators + node * kPrefetchStride);
+      bool right = compare_(separators[node], key);
+      node = 2 * node + static_cast<size_type>(right);
+    }
+    // Undoes the right turns below the last left one, which was taken at
+    // the first separator not less than key; no left turn means none is.
+    node >>= __builtin_ffsll(static_cast<long long>(~node));
+    if (node == 0) return count;
+
+    size_type first = Rank(node) * kBlock;
+    size_type length = count - first < kBlock ? count - first : kBlock;
+    return first + CountLess(keys_.data() + first, length, key);
+  }
+
+  // The position of key, or size().
+  template <typename K>
+  size_type Find(const K& key) const noexcept {
+    size_type index = LowerBound(key);
+    if (index != keys_.size() && compare_(key, keys_.data()[index]))
+      return keys_.size();
+    return index;
+  }
+
+  template <typename K>
+  size_type UpperBound(const K& key) const noexcept {
+    size_type index = LowerBound(key);
+    if (index != keys_.size() && !compare_(key, keys_.data()[index]))
+      ++index;
+    return index;
+  }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  // Keys per block, as many as share a cache line.
+  static constexpr size_type kBlock =
+      sizeof(key_type) < kCacheLine ? kCacheLine / sizeof(key_type) : 1;
+  // The descendants of node k that are log2(stride) levels down start at
+  // k * stride and fill a cache line between them.
+  static constexpr size_type kPrefetchStride = [] {
+    size_type stride = 1;
+    while (2 * stride * sizeof(key_type) <= kCacheLine) stride *= 2;
+    return stride;
+  }();
+
+  // Fills the tree level by level. Slot 0 is unused, which keeps the
+  // descendants of a node on as few cache lines as possible.
+  void Build() {
+    separators_.clear();
+    height_ = 0;
+    size_type count = keys_.size();
+    if (count == 0) return;
+
+    size_type blocks = (count + kBlock - 1) / kBlock;
+    while ((size_type(1) << height_) - 1 < blocks) ++height_;
+    size_type nodes = (size_type(1) << height_) - 1;
+
+    const key_type* keys = keys_.data();
+    separators_.reserve(nodes + 1);
+    separators_.push_back(keys[count - 1]);
+    for (size_type node = 1; node <= nodes; ++node) {
+      size_type block = Rank(node);
+      size_type last = block < blocks ? (block + 1) * kBlock : count;
+      separators_.push_back(keys[(last < count ? last : count) - 1]);
+    }
+  }
+
+  // The in-order position of node in the perfect tree of height_ levels.
+  size_type Rank(size_type node) const noexcept {
+    size_type depth = 63 - static_cast<size_type>(__builtin_clzll(node));
+    size_type offset = node - (size_type(1) << depth);
+    return ((2 * offset + 1) << (height_ - 1 - depth)) - 1;
+  }
+
+  // The number of the count keys from block on that are less than key.
+  template <typename K>
+  size_type CountLess(const key_type* block, size_type count,
+                      const K& key) const noexcept {
+#ifdef __SSE2__
+    if constexpr (kSimd<K>) {
+      if (count == kBlock) return CountLessSimd(block, key);
+    }
+#endif
+    size_type less = 0;
+    for (size_type i = 0; i < count; ++i)
+      less += static_cast<size_type>(compare_(block[i], key));
+    return less;
+  }
+
+  // Whether a block can be compared with plain signed int comparisons.
+  template <typename K>
+  static constexpr bool kSimd =
+      std::is_same<key_type, int>::value && std::is_same<K, int>::value &&
+      sizeof(int) == 4 &&
+      (std::is_same<key_compare, std::less<int>>::value ||
+       std::is_same<key_compare, std::less<>>::value);
+
+#ifdef __SSE2__
+  static size_type CountLessSimd(const int* block, int key) noexcept {
+    __m128i needle = _mm_set1_epi32(key);
+    uint64_t mask = 0;
+    for (size_type i = 0; i < kBlock; i += 4) {
+      __m128i four =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+      mask |= static_cast<uint64_t>(
+                  _mm_movemask_epi8(_mm_cmplt_epi32(four, needle)))
+              << (i * 4);
+    }
+    return static_cast<size_type>(__builtin_popcountll(mask)) / 4;
+  }
+#endif
+
+  container_type keys_;
+  // The last key of every block in Eytzinger order, from slot 1.
+  container_type separators_;
+  Compare compare_;
+  size_type height_ = 0;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_EYTZINGER_H
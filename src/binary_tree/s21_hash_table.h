@@ -0,0 +1,553 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_HASH_TABLE_H
+#define CPP2_S21_CONTAINERS_1_S21_HASH_TABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "s21_key_of_value.h"
+
+namespace s21 {
+// Sixteen control bytes of a HashTable, matched against one byte at once:
+// a compare and a movemask with SSE2, a loop the compiler can unroll
+// elsewhere. Bit i of a mask stands for byte i.
+class HashGroup {
+ public:
+  using ctrl_t = signed char;
+
+  static constexpr size_t kWidth = 16;
+  // A full slot stores the low seven bits of its hash, so only an empty
+  // slot has the sign bit set.
+  static constexpr ctrl_t kEmpty = -128;
+
+#ifdef __SSE2__
+  explicit HashGroup(const ctrl_t* ctrl) noexcept
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+#else
+  explicit HashGroup(const ctrl_t* ctrl) noexcept : ctrl_(ctrl) {}
+#endif
+
+  uint32_t Match(ctrl_t h2) const noexcept {
+#ifdef __SSE2__
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kWidth; ++i)
+      mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+    return mask;
+#endif
+  }
+
+  uint32_t MatchEmpty() const noexcept {
+#ifdef __SSE2__
+    return static_cast<uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+    return Match(kEmpty);
+#endif
+  }
+
+  uint32_t MatchFull() const noexcept { return ~MatchEmpty() & 0xFFFF; }
+
+  static size_t LowestBit(uint32_t mask) noexcept {
+    return static_cast<size_t>(__builtin_ctz(mask));
+  }
+
+ private:
+#ifdef __SSE2__
+  __m128i ctrl_;
+#else
+  const ctrl_t* ctrl_;
+#endif
+};
+
+// An open-addressing hash table in the SwissTable layout: one control byte
+// per slot holding seven bits of the hash, scanned sixteen at a time, so a
+// lookup compares keys only for slots whose byte matches. Probing is linear
+// from the slot the hash picks, one group after another, and erase shifts
+// the rest of the run back into the hole instead of leaving a tombstone, so
+// lookups stop at the first empty slot no matter how many erases there have
+// been. Values move when the table grows and when an erase shifts them, so
+// every insert and erase invalidates all iterators, and Hash must not throw
+// while rehashing.
+template <typename T, typename Key = T, typename KeyOfValue = Identity<T>,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<T>>
+class HashTable {
+ public:
+  using key_value = T;
+  using key_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+ private:
+  using slot_type = typename MutableSlot<T>::type;
+  using ctrl_t = HashGroup::ctrl_t;
+
+  static constexpr size_t kWidth = HashGroup::kWidth;
+  static constexpr ctrl_t kEmpty = HashGroup::kEmpty;
+  static constexpr size_t kMinCapacity = kWidth;
+
+  using slot_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<slot_type>;
+  using ctrl_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<ctrl_t>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = key_value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = key_value*;
+    using reference = key_value&;
+
+    iterator() noexcept = default;
+
+    iterator& operator++() noexcept {
+      ++ctrl_;
+      ++slot_;
+      SkipEmpty();
+      return *this;
+    }
+
+    iterator operator++(int) noexcept {
+      iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    key_value& operator*() const noexcept { return ValueOf(slot_); }
+    key_value* operator->() const noexcept { return &ValueOf(slot_); }
+
+    bool operator==(const iterator& other) const noexcept {
+      return ctrl_ == other.ctrl_;
+    }
+
+    bool operator!=(const iterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class HashTable;
+
+    iterator(ctrl_t* ctrl, slot_type* slot, ctrl_t* end) noexcept
+        : ctrl_(ctrl), slot_(slot), end_(end) {
+      SkipEmpty();
+    }
+
+    // Jumps over a whole group of empty slots at a time, but never past
+    // end_, after which the control bytes only mirror the first ones.
+    void SkipEmpty() noexcept {
+      while (ctrl_ != end_ && *ctrl_ == kEmpty) {
+        uint32_t full = HashGroup(ctrl_).MatchFull();
+        size_t skip = full ? HashGroup::LowestBit(full) : kWidth;
+        skip = std::min<size_t>(skip, static_cast<size_t>(end_ - ctrl_));
+        ctrl_ += skip;
+        slot_ += skip;
+      }
+    }
+
+    ctrl_t* ctrl_ = nullptr;
+    slot_type* slot_ = nullptr;
+    ctrl_t* end_ = nullptr;
+  };
+
+  using const_iterator = const iterator;
+
+  HashTable() noexcept(noexcept(Hash()) && noexcept(KeyEqual()) &&
+                       noexcept(Allocator())) = default;
+
+  explicit HashTable(const Hash& hash, const KeyEqual& equal = KeyEqual(),
+                     const Allocator& alloc = Allocator())
+      : hash_(hash), equal_(equal), alloc_(alloc) {}
+
+  HashTable(const HashTable& other, const Allocator& alloc)
+      : hash_(other.hash_), equal_(other.equal_), alloc_(alloc) {
+    CloneFrom(other, [](slot_type& slot) -> const slot_type& { return slot; });
+  }
+
+  // Takes the storage of other along with its allocator, so the memory is
+  // still returned to where it came from.
+  HashTable(HashTable&& other) noexcept
+      : ctrl_(std::exchange(other.ctrl_, nullptr)),
+        slots_(std::exchange(other.slots_, nullptr)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        hash_(other.hash_),
+        equal_(other.equal_),
+        alloc_(std::move(other.alloc_)) {}
+
+  HashTable(const HashTable&) = delete;
+
+  // Copies other into a table of its own and swaps that in, so this table
+  // is left as it was should copying throw. The allocator of other comes
+  // along only when it propagates on copy assignment.
+  HashTable& operator=(const HashTable& other) {
+    if (this == &other) return *this;
+
+    HashTable copy(other,
+                   alloc_traits::propagate_on_container_copy_assignment::value
+                       ? other.alloc_
+                       : alloc_);
+    swap(copy);
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value &&
+                  !alloc_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, copy.alloc_);
+    return *this;
+  }
+
+  // O(1) when the allocator propagates or the two compare equal. Otherwise
+  // the storage of other cannot be adopted, so its elements move one by
+  // one into slots from this table's allocator. other is left empty.
+  HashTable& operator=(HashTable&& other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this == &other) return *this;
+
+    clear();
+    Deallocate();
+    hash_ = other.hash_;
+    equal_ = other.equal_;
+    if (alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_ == other.alloc_) {
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                        value)
+        alloc_ = std::move(other.alloc_);
+      ctrl_ = std::exchange(other.ctrl_, nullptr);
+      slots_ = std::exchange(other.slots_, nullptr);
+      capacity_ = std::exchange(other.capacity_, 0);
+      size_ = std::exchange(other.size_, 0);
+    } else {
+      CloneFrom(other, [](slot_type& slot) -> slot_type&& {
+        return std::move(slot);
+      });
+      other.clear();
+    }
+    return *this;
+  }
+
+  ~HashTable() noexcept {
+    clear();
+    Deallocate();
+  }
+
+  iterator begin() const noexcept {
+    return iterator(ctrl_, slots_, ctrl_ + capacity_);
+  }
+  iterator end() const noexcept {
+    return iterator(ctrl_ + capacity_, slots_ + capacity_, ctrl_ + capacity_);
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_t size() const noexcept { return size_; }
+  size_t max_size() const noexcept {
+    return std::numeric_limits<size_t>::max() /
+           (sizeof(slot_type) + sizeof(ctrl_t)) / 2;
+  }
+
+  // Keeps the slots for the elements to come.
+  void clear() noexcept {
+    for (size_t i = 0; size_ && i < capacity_; ++i) {
+      if (ctrl_[i] == kEmpty) continue;
+      slots_[i].~slot_type();
+      --size_;
+    }
+    if (capacity_) std::fill_n(ctrl_, capacity_ + kWidth - 1, kEmpty);
+  }
+
+  size_t bucket_count() const noexcept { return capacity_; }
+
+  float load_factor() const noexcept {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  float max_load_factor() const noexcept { return 0.875f; }
+
+  // Grows the table so that count elements fit without another rehash.
+  void reserve(size_t count) {
+    if (count <= GrowthLimit(capacity_)) return;
+    size_t capacity = kMinCapacity;
+    while (GrowthLimit(capacity) < count) capacity *= 2;
+    if (capacity > capacity_) Resize(capacity);
+  }
+
+  std::pair<iterator, bool> insert(const key_value& value) {
+    return try_emplace(KeyOfValue()(value), value);
+  }
+
+  std::pair<iterator, bool> insert(key_value&& value) {
+    return try_emplace(KeyOfValue()(value), std::move(value));
+  }
+
+  // The value is built before the search, which needs its key.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    slot_type value(std::forward<Args>(args)...);
+    return try_emplace(KeyOf(value), std::move(value));
+  }
+
+  // Builds the value from args only when key is not present yet.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+    size_t hash = HashOf(key);
+    size_t index = Find(key, hash);
+    if (index != capacity_) return {MakeIterator(index), false};
+
+    if (size_ >= GrowthLimit(capacity_))
+      Resize(capacity_ ? capacity_ * 2 : kMinCapacity);
+    index = FindEmpty(hash);
+    new (&slots_[index]) slot_type(std::forward<Args>(args)...);
+    SetCtrl(index, H2(hash));
+    ++size_;
+    return {MakeIterator(index), true};
+  }
+
+  iterator find(const key_type& key) const {
+    return MakeIterator(Find(key, HashOf(key)));
+  }
+
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  iterator find(const K& key) const {
+    return MakeIterator(Find(key, HashOf(key)));
+  }
+
+  bool contains(const key_type& key) const {
+    return Find(key, HashOf(key)) != capacity_;
+  }
+
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  bool contains(const K& key) const {
+    return Find(key, HashOf(key)) != capacity_;
+  }
+
+  void erase(iterator pos) {
+    if (pos.ctrl_ == pos.end_) return;
+    EraseAt(static_cast<size_t>(pos.ctrl_ - ctrl_));
+  }
+
+  size_t erase(const key_type& key) {
+    size_t index = Find(key, HashOf(key));
+    if (index == capacity_) return 0;
+    EraseAt(index);
+    return 1;
+  }
+
+  void swap(HashTable& other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+    if constexpr (alloc_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, other.alloc_);
+  }
+
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+ private:
+  // capacity_ is zero or a power of two of at least kWidth. The control
+  // array has kWidth - 1 more bytes than slots, a copy of the first ones,
+  // so a group can be loaded from any slot without wrapping by hand.
+  ctrl_t* ctrl_ = nullptr;
+  slot_type* slots_ = nullptr;
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  Hash hash_;
+  KeyEqual equal_;
+  Allocator alloc_;
+
+  // The slots of a map hold pair<Key, T>; callers see pair<const Key, T>.
+  static key_value& ValueOf(slot_type* slot) noexcept {
+    return *std::launder(reinterpret_cast<key_value*>(slot));
+  }
+
+  static const key_type& KeyOf(slot_type& value) noexcept {
+    return KeyOfValue()(ValueOf(&value));
+  }
+
+  // Seven eighths of the slots, which leaves every probe an empty slot to
+  // stop at.
+  static size_t GrowthLimit(size_t capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+
+  // std::hash of an integer is the integer itself. Multiplying spreads
+  // its bits upwards and the shift brings them back down, so consecutive
+  // keys neither start from neighbouring slots nor share a control byte.
+  template <typename K>
+  size_t HashOf(const K& key) const {
+    uint64_t hash = static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash ^ (hash >> 32));
+  }
+
+  static size_t H1(size_t hash) noexcept { return hash >> 7; }
+  static ctrl_t H2(size_t hash) noexcept {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+
+  iterator MakeIterator(size_t index) const noexcept {
+    return iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+  }
+
+  // The slot holding key, or capacity_ when there is none. Nothing between
+  // a key's first slot and its own is ever empty, so the first group with
+  // an empty slot ends the search.
+  template <typename K>
+  size_t Find(const K& key, size_t hash) const {
+    if (!size_) return capacity_;
+
+    size_t mask = capacity_ - 1;
+    ctrl_t h2 = H2(hash);
+    for (size_t position = H1(hash) & mask;;
+         position = (position + kWidth) & mask) {
+      HashGroup group(ctrl_ + position);
+      for (uint32_t match = group.Match(h2); match; match &= match - 1) {
+        size_t index = (position + HashGroup::LowestBit(match)) & mask;
+        if (equal_(KeyOf(slots_[index]), key)) return index;
+      }
+      if (group.MatchEmpty()) return capacity_;
+    }
+  }
+
+  // The first empty slot at or after the one hash picks.
+  size_t FindEmpty(size_t hash) const noexcept {
+    size_t mask = capacity_ - 1;
+    for (size_t position = H1(hash) & mask;;
+         position = (position + kWidth) & mask) {
+      if (uint32_t empty = HashGroup(ctrl_ + position).MatchEmpty())
+        return (position + HashGroup::LowestBit(empty)) & mask;
+    }
+  }
+
+  void SetCtrl(size_t index, ctrl_t value) noexcept {
+    ctrl_[index] = value;
+    if (index < kWidth - 1) ctrl_[capacity_ + index] = value;
+  }
+
+  // Backward shift: each later element of the run moves into the hole when
+  // that keeps it at or after the slot its hash picks, and leaves a new
+  // hole behind, until the run ends at an empty slot.
+  void EraseAt(size_t index) {
+    size_t mask = capacity_ - 1;
+    slots_[index].~slot_type();
+    SetCtrl(index, kEmpty);
+    --size_;
+
+    for (size_t next = (index + 1) & mask; ctrl_[next] != kEmpty;
+         next = (next + 1) & mask) {
+      size_t home = H1(HashOf(KeyOf(slots_[next]))) & mask;
+      if (((next - home) & mask) < ((next - index) & mask)) continue;
+      Relocate(&slots_[index], &slots_[next]);
+      SetCtrl(index, ctrl_[next]);
+      SetCtrl(next, kEmpty);
+      index = next;
+    }
+  }
+
+  void Resize(size_t capacity) {
+    ctrl_t* old_ctrl = ctrl_;
+    slot_type* old_slots = slots_;
+    size_t old_capacity = capacity_;
+
+    Allocate(capacity);
+    for (size_t i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] == kEmpty) continue;
+      size_t hash = HashOf(KeyOf(old_slots[i]));
+      size_t index = FindEmpty(hash);
+      Relocate(&slots_[index], &old_slots[i]);
+      SetCtrl(index, H2(hash));
+    }
+    Deallocate(old_ctrl, old_slots, old_capacity);
+  }
+
+  // Builds every element of other, as get hands it out, in the same slot
+  // of this empty table under the same control byte, so nothing is
+  // rehashed. If that throws, the table is left empty.
+  template <typename Get>
+  void CloneFrom(const HashTable& other, Get get) {
+    if (!other.size_) return;
+
+    Allocate(other.capacity_);
+    try {
+      for (size_t i = 0; i < capacity_; ++i) {
+        if (other.ctrl_[i] == kEmpty) continue;
+        new (&slots_[i]) slot_type(get(other.slots_[i]));
+        SetCtrl(i, other.ctrl_[i]);
+        ++size_;
+      }
+    } catch (...) {
+      clear();
+      Deallocate();
+      throw;
+    }
+  }
+
+  static void Relocate(slot_type* to, slot_type* from) noexcept {
+    new (to) slot_type(std::move(*from));
+    from->~slot_type();
+  }
+
+  // Points the table at capacity new empty slots; the old ones are left to
+  // the caller.
+  void Allocate(size_t capacity) {
+    slot_allocator slot_alloc(alloc_);
+    ctrl_allocator ctrl_alloc(alloc_);
+    slot_type* slots =
+        std::allocator_traits<slot_allocator>::allocate(slot_alloc, capacity);
+    ctrl_t* ctrl;
+    try {
+      ctrl = std::allocator_traits<ctrl_allocator>::allocate(
+          ctrl_alloc, capacity + kWidth - 1);
+    } catch (...) {
+      std::allocator_traits<slot_allocator>::deallocate(slot_alloc, slots,
+                                                        capacity);
+      throw;
+    }
+    std::fill_n(ctrl, capacity + kWidth - 1, kEmpty);
+    ctrl_ = ctrl;
+    slots_ = slots;
+    capacity_ = capacity;
+  }
+
+  void Deallocate() noexcept {
+    Deallocate(ctrl_, slots_, capacity_);
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+  }
+
+  void Deallocate(ctrl_t* ctrl, slot_type* slots, size_t capacity) noexcept {
+    if (!capacity) return;
+    slot_allocator slot_alloc(alloc_);
+    ctrl_allocator ctrl_alloc(alloc_);
+    std::allocator_traits<slot_allocator>::deallocate(slot_alloc, slots,
+                                                      capacity);
+    std::allocator_traits<ctrl_allocator>::deallocate(ctrl_alloc, ctrl,
+                                                      capacity + kWidth - 1);
+  }
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_HASH_TABLE_H
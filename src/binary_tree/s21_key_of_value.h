@@ -0,0 +1,40 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_KEY_OF_VALUE_H
+#define CPP2_S21_CONTAINERS_1_S21_KEY_OF_VALUE_H
+
+#include <utility>
+
+namespace s21 {
+// Tags constructors whose input is already sorted by key.
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+template <typename T>
+struct Identity {
+  const T& operator()(const T& value) const noexcept { return value; }
+};
+
+template <typename Pair>
+struct SelectFirst {
+  const typename Pair::first_type& operator()(
+      const Pair& value) const noexcept {
+    return value.first;
+  }
+};
+
+// What a container that moves its values between slots stores for a value:
+// a map keeps its pairs with a mutable key, so they can be moved, and hands
+// them out as pair<const Key, T>, which has the same layout.
+template <typename T>
+struct MutableSlot {
+  using type = T;
+};
+
+template <typename K, typename V>
+struct MutableSlot<std::pair<const K, V>> {
+  using type = std::pair<K, V>;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_KEY_OF_VALUE_H
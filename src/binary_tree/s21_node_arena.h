@@ -0,0 +1,173 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_NODE_ARENA_H
+#define CPP2_S21_CONTAINERS_1_S21_NODE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Hands out storage for one Node at a time from a single buffer that grows
+// geometrically, like the storage of s21::vector, so nodes can refer to
+// each other by index. Freed slots go to a free list of indices and are
+// reused before the buffer is consumed further. Growing moves every slot,
+// and the arena cannot tell live nodes from free ones, so the owner moves
+// the nodes itself through the relocate callback of reserve(); allocate()
+// never grows. The buffer comes from Allocator rebound to the slot type.
+template <typename Node, typename Allocator = std::allocator<Node>>
+class NodeArena {
+ private:
+  union Slot;
+  using slot_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+ public:
+  using allocator_type = slot_allocator;
+
+  // Nodes link by 32-bit offsets, so no arena grows past this many slots.
+  static constexpr std::size_t kMaxCapacity = std::size_t(1) << 30;
+
+  NodeArena() noexcept(noexcept(slot_allocator())) = default;
+  explicit NodeArena(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  NodeArena(const NodeArena&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+  ~NodeArena() noexcept { release(); }
+
+  // The first slot, or null before anything was reserved.
+  void* data() const noexcept { return slots_; }
+  void* slot(std::size_t index) const noexcept { return slots_ + index; }
+  std::size_t index_of(const void* node) const noexcept {
+    return static_cast<std::size_t>(static_cast<const Slot*>(node) - slots_);
+  }
+
+  std::size_t capacity() const noexcept { return capacity_; }
+  // How many allocate() calls the arena serves before it needs to grow.
+  std::size_t available() const noexcept {
+    return capacity_ - used_ + free_count_;
+  }
+
+  // available() must not be 0.
+  void* allocate() noexcept {
+    if (free_list_ != kNone) {
+      Slot* slot = slots_ + free_list_;
+      free_list_ = slot->next;
+      --free_count_;
+      return slot;
+    }
+    return slots_ + used_++;
+  }
+
+  void deallocate(void* node) noexcept {
+    Slot* slot = static_cast<Slot*>(node);
+    slot->next = free_list_;
+    free_list_ = static_cast<std::uint32_t>(slot - slots_);
+    ++free_count_;
+  }
+
+  // Makes sure the next count allocations need no growth. Growing moves the
+  // arena to a new buffer at least twice the size: relocate(from, to, used)
+  // must construct every live node among the first used slots of the old
+  // buffer at from in the same slot of the new one at to and destroy the old
+  // ones, while the free slots are carried over here. If relocate throws,
+  // the arena stays where it was.
+  template <typename Relocate>
+  void reserve(std::size_t count, Relocate relocate) {
+    if (available() >= count) return;
+
+    std::size_t needed = used_ + count - free_count_;
+    if (needed > kMaxCapacity) throw std::length_error("NodeArena: too big");
+    std::size_t capacity = capacity_ < kFirstCapacity ? kFirstCapacity
+                           : capacity_ < kMaxCapacity / 2 ? 2 * capacity_
+                                                          : kMaxCapacity;
+    if (capacity < needed) capacity = needed;
+
+    Slot* grown = slot_traits::allocate(alloc_, capacity);
+    if (slots_) {
+      try {
+        relocate(static_cast<void*>(slots_), static_cast<void*>(grown), used_);
+      } catch (...) {
+        slot_traits::deallocate(alloc_, grown, capacity);
+        throw;
+      }
+      for (std::uint32_t i = free_list_; i != kNone; i = slots_[i].next)
+        grown[i].next = slots_[i].next;
+      slot_traits::deallocate(alloc_, slots_, capacity_);
+    }
+    slots_ = grown;
+    capacity_ = capacity;
+  }
+
+  // Makes this empty arena a copy of other byte for byte, free list and
+  // all, which is only correct for nodes that are trivially copyable in all
+  // but name.
+  void copy(const NodeArena& other) {
+    if (!other.slots_) return;
+
+    slots_ = slot_traits::allocate(alloc_, other.used_);
+    capacity_ = used_ = other.used_;
+    std::memcpy(static_cast<void*>(slots_), other.slots_,
+                other.used_ * sizeof(Slot));
+    free_list_ = other.free_list_;
+    free_count_ = other.free_count_;
+  }
+
+  // Frees the buffer. Nodes still handed out become dangling, so the owner
+  // must have destroyed them first.
+  void release() noexcept {
+    if (slots_) slot_traits::deallocate(alloc_, slots_, capacity_);
+    slots_ = nullptr;
+    capacity_ = used_ = free_count_ = 0;
+    free_list_ = kNone;
+  }
+
+  // Storage for one node outside the arena, for a node handle to own.
+  void* allocate_detached() { return slot_traits::allocate(alloc_, 1); }
+
+  static void deallocate_detached(allocator_type& alloc, void* node) noexcept {
+    slot_traits::deallocate(alloc, static_cast<Slot*>(node), 1);
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  void swap(NodeArena& other) noexcept {
+    if constexpr (slot_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, other.alloc_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(used_, other.used_);
+    std::swap(free_list_, other.free_list_);
+    std::swap(free_count_, other.free_count_);
+  }
+
+  // Trades allocators alone, for a container whose assignment propagates
+  // the allocator when its swap does not. Each arena must be left holding
+  // the allocator its memory came from.
+  void swap_allocator(NodeArena& other) noexcept {
+    std::swap(alloc_, other.alloc_);
+  }
+
+ private:
+  union Slot {
+    std::uint32_t next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  static_assert(sizeof(Slot) == sizeof(Node), "slots must be node-sized");
+
+  static constexpr std::size_t kFirstCapacity = 16;
+  static constexpr std::uint32_t kNone = UINT32_MAX;
+
+  slot_allocator alloc_;
+  Slot* slots_ = nullptr;
+  std::size_t capacity_ = 0;
+  // Slots below used_ have been handed out at least once.
+  std::size_t used_ = 0;
+  std::uint32_t free_list_ = kNone;
+  std::size_t free_count_ = 0;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_NODE_ARENA_H
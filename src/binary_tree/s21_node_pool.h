@@ -0,0 +1,374 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_NODE_POOL_H
+#define CPP2_S21_CONTAINERS_1_S21_NODE_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace s21 {
+// Hands out storage for one Node at a time from slabs that grow
+// geometrically. Freed nodes go to a free list and are reused before the
+// current slab is consumed further; the slabs themselves are only returned
+// by release(), all at once. Slabs come from Allocator rebound to the slot
+// type, so a pmr allocator places the whole tree in its memory resource.
+//
+// A slab is made of chunks aligned to their own power-of-two size, and the
+// first slot of every chunk names the slab, so the slab of any node is
+// found by masking its address. That costs a slot and the rounding of each
+// chunk, a few percent of the memory, and Allocator has to honor the
+// alignment of the type it allocates, as std and pmr allocators do.
+//
+// A node can also leave the pool in place, for a node handle: detach()
+// makes its slab outlive the pool for as long as the node is out, and
+// attach() lets another pool with an equal allocator take the node in,
+// borrowing the slab from then on. Each slab counts the pool that made it,
+// the detached nodes and the borrowing pools, and goes with the last, so
+// one detached node can keep up to kMaxSlabCapacity slots alive.
+template <typename Node, typename Allocator = std::allocator<Node>>
+class NodePool {
+ private:
+  union Slot;
+  using slot_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+ public:
+  using allocator_type = slot_allocator;
+
+  NodePool() noexcept(noexcept(slot_allocator())) = default;
+  explicit NodePool(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  NodePool(const NodePool&) = delete;
+  NodePool& operator=(const NodePool&) = delete;
+  ~NodePool() noexcept { release(); }
+
+  void* allocate() {
+    if (free_list_) {
+      Slot* slot = free_list_;
+      free_list_ = slot->next;
+      return slot;
+    }
+
+    if (next_ == end_) NextChunk();
+    return next_++;
+  }
+
+  // Makes sure the next count allocations are carved from a single slab.
+  void reserve(std::size_t count) {
+    std::size_t left = static_cast<std::size_t>(end_ - next_) +
+                       static_cast<std::size_t>(end_chunk_ - next_chunk_) *
+                           (kChunkSlots - 1);
+    if (left < count)
+      AddSlab((count + kSlabSlots - 1 + kChunkSlots - 2) / (kChunkSlots - 1));
+  }
+
+  void deallocate(void* node) noexcept {
+    Slot* slot = static_cast<Slot*>(node);
+    slot->next = free_list_;
+    free_list_ = slot;
+  }
+
+  // Lets go of every slab, which frees those no detached node or other
+  // pool still holds. Nodes still handed out become dangling, so the owner
+  // must have destroyed them first.
+  void release() noexcept {
+    while (borrowed_) {
+      Borrow* next = borrowed_->next;
+      Unref(alloc_, borrowed_->slab);
+      borrowed_ = next;
+    }
+    FreeIndex();
+    while (slabs_) {
+      Slab* next = slabs_->next;
+      Unref(alloc_, slabs_);
+      slabs_ = next;
+    }
+
+    id_ = 0;
+    free_list_ = next_ = end_ = nullptr;
+    next_chunk_ = end_chunk_ = nullptr;
+    slab_chunks_ = 1;
+  }
+
+  // Lets node, handed out by this pool, leave it without moving: its slab
+  // is kept until the returned ticket goes to attach() or to
+  // release_detached().
+  void* detach(void* node) noexcept {
+    Slab* slab = SlabOf(node);
+    slab->refs.fetch_add(1, std::memory_order_relaxed);
+    return slab;
+  }
+
+  // Takes in the node detached under ticket from a pool whose allocator
+  // compares equal to this one's. A slab this pool does not hold yet is
+  // borrowed through a record in a slot of its own, which may throw, and
+  // then nothing changes.
+  void attach(void* ticket) {
+    Slab* slab = static_cast<Slab*>(ticket);
+    if (slab->maker.load(std::memory_order_relaxed) == id_ ||
+        Indexed(slab)) {
+      Unref(alloc_, slab);
+      return;
+    }
+    ReserveIndex();
+    borrowed_ = new (allocate()) Borrow{slab, borrowed_};
+    Index(slab);
+  }
+
+  // For a detached node that is destroyed instead. Its slot is not reused,
+  // but the slab is freed if nothing else holds it any more.
+  static void release_detached(allocator_type& alloc, void* ticket) noexcept {
+    Unref(alloc, static_cast<Slab*>(ticket));
+  }
+
+  // Takes over every slab of other, whose allocator must compare equal to
+  // this pool's, so the nodes other handed out now live in this pool. The
+  // unused slots of other are added to the free list and other is left
+  // empty. The slabs other borrowed are not indexed here, which at worst
+  // costs attach() one more record for each.
+  void absorb(NodePool& other) noexcept {
+    if (!other.slabs_) return;
+
+    Slab* last_slab = other.slabs_;
+    for (;; last_slab = last_slab->next) {
+      last_slab->maker.store(Id(), std::memory_order_relaxed);
+      if (!last_slab->next) break;
+    }
+    last_slab->next = slabs_;
+    slabs_ = other.slabs_;
+
+    for (Slot* slot = other.next_; slot != other.end_; ++slot)
+      deallocate(slot);
+    for (Chunk* chunk = other.next_chunk_; chunk != other.end_chunk_; ++chunk)
+      for (std::size_t i = 1; i < kChunkSlots; ++i)
+        deallocate(&chunk->slots[i]);
+    if (other.free_list_) {
+      Slot* last_free = other.free_list_;
+      while (last_free->next) last_free = last_free->next;
+      last_free->next = free_list_;
+      free_list_ = other.free_list_;
+    }
+
+    if (other.borrowed_) {
+      Borrow* last_borrow = other.borrowed_;
+      while (last_borrow->next) last_borrow = last_borrow->next;
+      last_borrow->next = borrowed_;
+      borrowed_ = other.borrowed_;
+    }
+
+    other.FreeIndex();
+    other.id_ = 0;
+    other.slabs_ = nullptr;
+    other.borrowed_ = nullptr;
+    other.free_list_ = other.next_ = other.end_ = nullptr;
+    other.next_chunk_ = other.end_chunk_ = nullptr;
+    other.slab_chunks_ = 1;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  void swap(NodePool& other) noexcept {
+    if constexpr (slot_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, other.alloc_);
+    std::swap(id_, other.id_);
+    std::swap(slabs_, other.slabs_);
+    std::swap(borrowed_, other.borrowed_);
+    std::swap(index_, other.index_);
+    std::swap(index_capacity_, other.index_capacity_);
+    std::swap(index_size_, other.index_size_);
+    std::swap(free_list_, other.free_list_);
+    std::swap(next_, other.next_);
+    std::swap(end_, other.end_);
+    std::swap(next_chunk_, other.next_chunk_);
+    std::swap(end_chunk_, other.end_chunk_);
+    std::swap(slab_chunks_, other.slab_chunks_);
+  }
+
+  // Trades allocators alone, for a container whose assignment propagates
+  // the allocator when its swap does not. Each pool must be left holding
+  // the allocator its memory came from.
+  void swap_allocator(NodePool& other) noexcept {
+    std::swap(alloc_, other.alloc_);
+  }
+
+ private:
+  struct Slab;
+
+  union Slot {
+    Slot* next;
+    // In the first slot of a chunk.
+    Slab* slab;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  // Lives in the slots after the first of a slab's first chunk. refs counts
+  // the pool that made it, its detached nodes and the pools borrowing it;
+  // maker is the id of the pool whose slabs_ it is in.
+  struct Slab {
+    Slab* next;
+    std::size_t chunks;
+    std::atomic<std::size_t> refs;
+    std::atomic<std::uint64_t> maker;
+  };
+
+  // A slab of another pool that nodes of this one live in.
+  struct Borrow {
+    Slab* slab;
+    Borrow* next;
+  };
+
+  static_assert(alignof(Slab) <= alignof(Slot), "slab header misaligned");
+  static_assert(sizeof(Borrow) <= sizeof(Slot), "a borrow must fit a slot");
+
+  static constexpr std::size_t kFirstSlabCapacity = 16;
+  static constexpr std::size_t kMaxSlabCapacity = 4096;
+  // The first slot of a slab's first chunk and those the Slab takes.
+  static constexpr std::size_t kSlabSlots =
+      1 + (sizeof(Slab) + sizeof(Slot) - 1) / sizeof(Slot);
+  // Enough for the first slab to be a single chunk.
+  static constexpr std::size_t kChunkBytes = [] {
+    std::size_t bytes = 1;
+    while (bytes < (kSlabSlots + kFirstSlabCapacity) * sizeof(Slot))
+      bytes *= 2;
+    return bytes;
+  }();
+  static constexpr std::size_t kChunkSlots = kChunkBytes / sizeof(Slot);
+  static constexpr std::size_t kMaxSlabChunks = [] {
+    std::size_t chunks = 1;
+    while (chunks * (kChunkSlots - 1) < kMaxSlabCapacity) chunks *= 2;
+    return chunks;
+  }();
+
+  struct alignas(kChunkBytes) Chunk {
+    Slot slots[kChunkSlots];
+  };
+
+  using chunk_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+  using chunk_traits = std::allocator_traits<chunk_allocator>;
+  using index_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slab*>;
+  using index_traits = std::allocator_traits<index_allocator>;
+
+  // Tells the slabs of different pools apart; 0 is none yet.
+  static inline std::atomic<std::uint64_t> next_id_{1};
+
+  slot_allocator alloc_;
+  std::uint64_t id_ = 0;
+  Slab* slabs_ = nullptr;
+  Borrow* borrowed_ = nullptr;
+  // An open-addressing set of the slabs in borrowed_, so that attach() needs
+  // no walk to find out whether it already holds a slab.
+  Slab** index_ = nullptr;
+  std::size_t index_capacity_ = 0;
+  std::size_t index_size_ = 0;
+  Slot* free_list_ = nullptr;
+  // The rest of the chunk being carved, and of the slab it is part of.
+  Slot* next_ = nullptr;
+  Slot* end_ = nullptr;
+  Chunk* next_chunk_ = nullptr;
+  Chunk* end_chunk_ = nullptr;
+  std::size_t slab_chunks_ = 1;
+
+  std::uint64_t Id() noexcept {
+    if (!id_) id_ = next_id_.fetch_add(1, std::memory_order_relaxed);
+    return id_;
+  }
+
+  void NextChunk() {
+    if (next_chunk_ == end_chunk_) {
+      AddSlab(slab_chunks_);
+      return;
+    }
+    next_ = next_chunk_->slots + 1;
+    end_ = next_chunk_->slots + kChunkSlots;
+    ++next_chunk_;
+  }
+
+  void AddSlab(std::size_t chunks) {
+    chunk_allocator alloc(alloc_);
+    Chunk* first = chunk_traits::allocate(alloc, chunks);
+    Slab* slab = new (&first->slots[1]) Slab{slabs_, chunks, {1}, {Id()}};
+    for (Chunk* chunk = first; chunk != first + chunks; ++chunk)
+      chunk->slots[0].slab = slab;
+    slabs_ = slab;
+
+    next_ = first->slots + kSlabSlots;
+    end_ = first->slots + kChunkSlots;
+    next_chunk_ = first + 1;
+    end_chunk_ = first + chunks;
+    if (slab_chunks_ < kMaxSlabChunks) slab_chunks_ *= 2;
+  }
+
+  static Chunk* ChunkOf(const void* address) noexcept {
+    return reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(address) &
+                                    ~std::uintptr_t(kChunkBytes - 1));
+  }
+
+  static Slab* SlabOf(const void* node) noexcept {
+    return ChunkOf(node)->slots[0].slab;
+  }
+
+  static void Unref(slot_allocator& alloc, Slab* slab) noexcept {
+    if (slab->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    std::size_t chunks = slab->chunks;
+    Chunk* first = ChunkOf(slab);
+    slab->~Slab();
+    chunk_allocator chunk_alloc(alloc);
+    chunk_traits::deallocate(chunk_alloc, first, chunks);
+  }
+
+  // Slabs sit at distinct chunks, so the chunk number spreads them well.
+  std::size_t IndexSlot(const Slab* slab) const noexcept {
+    return (reinterpret_cast<std::uintptr_t>(slab) / kChunkBytes) &
+           (index_capacity_ - 1);
+  }
+
+  bool Indexed(const Slab* slab) const noexcept {
+    if (!index_) return false;
+    std::size_t mask = index_capacity_ - 1;
+    for (std::size_t i = IndexSlot(slab);; i = (i + 1) & mask) {
+      if (index_[i] == slab) return true;
+      if (!index_[i]) return false;
+    }
+  }
+
+  // Makes room in index_ for one more slab, keeping it at most half full.
+  void ReserveIndex() {
+    if (2 * (index_size_ + 1) <= index_capacity_) return;
+
+    std::size_t capacity = index_capacity_ ? 2 * index_capacity_ : 8;
+    index_allocator alloc(alloc_);
+    Slab** index = index_traits::allocate(alloc, capacity);
+    std::uninitialized_fill_n(index, capacity, nullptr);
+    std::swap(index, index_);
+    std::swap(capacity, index_capacity_);
+    index_size_ = 0;
+    if (index) {
+      for (std::size_t i = 0; i < capacity; ++i)
+        if (index[i]) Index(index[i]);
+      index_traits::deallocate(alloc, index, capacity);
+    }
+  }
+
+  void Index(Slab* slab) noexcept {
+    std::size_t i = IndexSlot(slab);
+    while (index_[i]) i = (i + 1) & (index_capacity_ - 1);
+    index_[i] = slab;
+    ++index_size_;
+  }
+
+  void FreeIndex() noexcept {
+    if (index_) {
+      index_allocator alloc(alloc_);
+      index_traits::deallocate(alloc, index_, index_capacity_);
+    }
+    index_ = nullptr;
+    index_capacity_ = index_size_ = 0;
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_NODE_POOL_H
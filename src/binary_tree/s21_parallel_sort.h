@@ -0,0 +1,45 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_PARALLEL_SORT_H
+#define CPP2_S21_CONTAINERS_1_S21_PARALLEL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <system_error>
+#include <thread>
+
+namespace s21 {
+namespace parallel_sort_detail {
+constexpr std::ptrdiff_t kSerialCutoff = 1 << 14;
+
+template <typename RandomIt, typename Less>
+void Sort(RandomIt first, RandomIt last, const Less& less, unsigned threads) {
+  if (threads <= 1 || last - first < kSerialCutoff) {
+    std::stable_sort(first, last, less);
+    return;
+  }
+
+  RandomIt middle = first + (last - first) / 2;
+  std::thread left;
+  try {
+    left = std::thread([&] { Sort(first, middle, less, threads / 2); });
+  } catch (const std::system_error&) {
+    // No thread to spare: sort the left half on this one instead.
+    std::stable_sort(first, middle, less);
+  }
+  Sort(middle, last, less, threads - threads / 2);
+  if (left.joinable()) left.join();
+  std::inplace_merge(first, middle, last, less);
+}
+}  // namespace parallel_sort_detail
+
+// Stable merge sort that splits the range between up to threads threads,
+// or std::thread::hardware_concurrency() of them when threads is 0. The
+// comparator runs concurrently and must not throw.
+template <typename RandomIt, typename Less>
+void ParallelSort(RandomIt first, RandomIt last, const Less& less,
+                  unsigned threads = 0) {
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  parallel_sort_detail::Sort(first, last, less, threads);
+}
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_PARALLEL_SORT_H
@@ -0,0 +1,257 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../binary_tree/s21_btree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// A drop-in alternative to s21::map backed by a B-tree: lookups and scans
+// touch far fewer cache lines, at the price that insert and erase invalidate
+// every iterator and every reference to an element. There are no node
+// handles, nth() or rank().
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class btree_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using tree_type = BTree<value_type, key_type, SelectFirst<value_type>,
+                          key_compare, allocator_type>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reverse_iterator = typename tree_type::reverse_iterator;
+  using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+  using size_type = std::size_t;
+
+  btree_map() noexcept = default;
+
+  explicit btree_map(const key_compare &compare,
+                     const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {}
+
+  explicit btree_map(const allocator_type &alloc)
+      : tree_(key_compare(), alloc) {}
+
+  btree_map(std::initializer_list<value_type> const &items,
+            const allocator_type &alloc = allocator_type())
+      : tree_(key_compare(), alloc) {
+    for (const auto &item : items) tree_.insert(item);
+  }
+
+  template <typename InputIt>
+  btree_map(sorted_unique_t, InputIt first, InputIt last,
+            const key_compare &compare = key_compare(),
+            const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {
+    tree_.assign_sorted(first, last);
+  }
+
+  btree_map(const btree_map &m)
+      : tree_(m.key_comp(), std::allocator_traits<allocator_type>::
+                                select_on_container_copy_construction(
+                                    m.get_allocator())) {
+    tree_.assign_sorted(m.begin(), m.end());
+  }
+
+  btree_map(btree_map &&m) noexcept : tree_(std::move(m.tree_)) {}
+
+  ~btree_map() noexcept = default;
+
+  btree_map &operator=(const btree_map &m) {
+    tree_ = m.tree_;
+    return *this;
+  }
+
+  btree_map &operator=(btree_map &&m) noexcept(
+      std::is_nothrow_move_assignable<tree_type>::value) {
+    tree_ = std::move(m.tree_);
+    return *this;
+  }
+
+  mapped_type &at(const key_type &key) const {
+    iterator it = find(key);
+
+    if (it == end()) throw std::out_of_range("Key not found");
+    return (*it).second;
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  mapped_type &at(const K &key) const {
+    iterator it = find(key);
+
+    if (it == end()) throw std::out_of_range("Key not found");
+    return (*it).second;
+  }
+
+  // Inserts a value-initialized element when key is missing.
+  mapped_type &operator[](const key_type &key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  mapped_type &operator[](key_type &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
+  iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() const noexcept { return tree_.end(); }
+  reverse_iterator rbegin() const noexcept { return tree_.rbegin(); }
+  reverse_iterator rend() const noexcept { return tree_.rend(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  void clear() noexcept { tree_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.insert(std::move(value));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return tree_.try_emplace(key, key, obj);
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = tree_.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result = tree_.try_emplace(key, std::move(key), std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  }
+
+  // Leaves args untouched when key is already present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.insert(hint, value);
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) noexcept { tree_.erase(pos); }
+
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last);
+  }
+
+  void swap(btree_map &other) noexcept { tree_.swap(other.tree_); }
+
+  // Moves the elements of other whose keys are not here yet into this map;
+  // the rest stay in other.
+  void merge(btree_map &other) { tree_.merge(other.tree_); }
+
+  iterator find(const key_type &key) const noexcept { return tree_.find(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }
+
+  bool contains(const key_type &key) const noexcept {
+    return tree_.contains(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }
+
+  iterator lower_bound(const key_type &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const key_type &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(
+      const key_type &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+ private:
+  tree_type tree_;
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using btree_map =
+    s21::btree_map<Key, T, Compare,
+                   std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
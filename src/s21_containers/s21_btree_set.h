@@ -0,0 +1,200 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "../binary_tree/s21_btree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// A drop-in alternative to s21::set backed by a B-tree: lookups and scans
+// touch far fewer cache lines, at the price that insert and erase invalidate
+// every iterator. There are no node handles, nth() or rank().
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+class btree_set {
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using tree_type = BTree<value_type, key_type, Identity<value_type>,
+                          key_compare, allocator_type>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reverse_iterator = typename tree_type::reverse_iterator;
+  using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+  using size_type = std::size_t;
+
+  btree_set() noexcept = default;
+
+  explicit btree_set(const key_compare &compare,
+                     const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {}
+
+  explicit btree_set(const allocator_type &alloc)
+      : tree_(key_compare(), alloc) {}
+
+  btree_set(std::initializer_list<value_type> const &items,
+            const allocator_type &alloc = allocator_type())
+      : tree_(key_compare(), alloc) {
+    for (const auto &item : items) tree_.insert(item);
+  }
+
+  template <typename InputIt>
+  btree_set(sorted_unique_t, InputIt first, InputIt last,
+            const key_compare &compare = key_compare(),
+            const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {
+    tree_.assign_sorted(first, last);
+  }
+
+  btree_set(const btree_set &s)
+      : tree_(s.key_comp(), std::allocator_traits<allocator_type>::
+                                select_on_container_copy_construction(
+                                    s.get_allocator())) {
+    tree_.assign_sorted(s.begin(), s.end());
+  }
+
+  btree_set(btree_set &&s) noexcept : tree_(std::move(s.tree_)) {}
+
+  ~btree_set() noexcept = default;
+
+  btree_set &operator=(const btree_set &s) {
+    tree_ = s.tree_;
+    return *this;
+  }
+
+  btree_set &operator=(btree_set &&s) noexcept(
+      std::is_nothrow_move_assignable<tree_type>::value) {
+    tree_ = std::move(s.tree_);
+    return *this;
+  }
+
+  iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() const noexcept { return tree_.end(); }
+  reverse_iterator rbegin() const noexcept { return tree_.rbegin(); }
+  reverse_iterator rend() const noexcept { return tree_.rend(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  void clear() noexcept { tree_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  }
+
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.insert(hint, value);
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) noexcept { tree_.erase(pos); }
+
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last);
+  }
+
+  void swap(btree_set &other) noexcept { tree_.swap(other.tree_); }
+
+  // Moves the elements of other whose keys are not here yet into this set;
+  // the rest stay in other.
+  void merge(btree_set &other) { tree_.merge(other.tree_); }
+
+  iterator find(const Key &key) const noexcept { return tree_.find(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }
+
+  bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }
+
+  iterator lower_bound(const Key &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const Key &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const Key &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+  // The returned iterators are only valid if no later argument inserted.
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> results;
+    results.reserve(sizeof...(Args));
+
+    ((results.push_back(insert(std::forward<Args>(args)))), ...);
+
+    return results;
+  }
+
+ private:
+  tree_type tree_;
+};
+
+namespace pmr {
+template <typename Key, typename Compare = std::less<Key>>
+using btree_set =
+    s21::btree_set<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
@@ -0,0 +1,191 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_CONCURRENT_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_CONCURRENT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "s21_unordered_map.h"
+
+namespace s21 {
+// A hash map that any number of threads can use at once. Keys are split
+// over a power-of-two number of shards by hash, and each shard is an
+// s21::unordered_map behind its own reader-writer lock, so threads only
+// contend when they touch the same shard and lookups never block each
+// other. Every shard sits on its own cache lines, so taking one lock does
+// not evict its neighbours from other cores.
+//
+// Nothing hands out references into the map, since another thread could
+// erase the element at any time: find() returns a copy, update() runs a
+// function on the element under the lock, and for_each() visits one shard
+// at a time, each as it is at a single moment.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using shard_type =
+      s21::unordered_map<key_type, mapped_type, hasher, key_equal,
+                         allocator_type>;
+  using size_type = std::size_t;
+
+  static constexpr size_type kDefaultShards = 64;
+
+  // shards is rounded up to a power of two.
+  explicit concurrent_map(size_type shards = kDefaultShards,
+                          const hasher &hash = hasher(),
+                          const key_equal &equal = key_equal(),
+                          const allocator_type &alloc = allocator_type())
+      : hash_(hash) {
+    while ((size_type(1) << shard_bits_) < shards) ++shard_bits_;
+    for (size_type i = 0; i < shard_count(); ++i)
+      shards_.emplace_back(hash, equal, alloc);
+  }
+
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+  ~concurrent_map() noexcept = default;
+
+  size_type shard_count() const noexcept {
+    return size_type(1) << shard_bits_;
+  }
+
+  // The sum of the shard sizes, each read at a different moment.
+  size_type size() const {
+    size_type total = 0;
+    for (size_type i = 0; i < shard_count(); ++i) {
+      std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+      total += shards_[i].map.size();
+    }
+    return total;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  void clear() {
+    for (size_type i = 0; i < shard_count(); ++i) {
+      std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+      shards_[i].map.clear();
+    }
+  }
+
+  // A copy of the value mapped to key, if there is one.
+  std::optional<mapped_type> find(const key_type &key) const {
+    const Shard &shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return std::nullopt;
+    return (*it).second;
+  }
+
+  bool contains(const key_type &key) const {
+    const Shard &shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.contains(key);
+  }
+
+  // Returns whether the element was inserted; an existing one is kept.
+  bool insert(const key_type &key, const mapped_type &obj) {
+    Shard &shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.insert(key, obj).second;
+  }
+
+  bool insert(const value_type &value) {
+    Shard &shard = ShardOf(value.first);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.insert(value).second;
+  }
+
+  bool insert(value_type &&value) {
+    Shard &shard = ShardOf(value.first);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.insert(std::move(value)).second;
+  }
+
+  // Returns whether the element was inserted rather than assigned.
+  template <typename M>
+  bool insert_or_assign(const key_type &key, M &&obj) {
+    Shard &shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.insert_or_assign(key, std::forward<M>(obj)).second;
+  }
+
+  size_type erase(const key_type &key) {
+    Shard &shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.erase(key);
+  }
+
+  // Calls fn(mapped_type &) on the element mapped to key while holding its
+  // shard exclusively, so a read-modify-write needs no lock of its own.
+  // Returns whether there was such an element. fn must not use this map.
+  template <typename F>
+  bool update(const key_type &key, F &&fn) {
+    Shard &shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return false;
+    std::forward<F>(fn)((*it).second);
+    return true;
+  }
+
+  // Calls fn(const value_type &) for every element, one shard at a time
+  // under its shared lock: the elements of a shard are seen as they were
+  // at one moment, different shards at different moments. fn must not
+  // write to this map.
+  template <typename F>
+  void for_each(F &&fn) const {
+    for (size_type i = 0; i < shard_count(); ++i) {
+      std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+      for (const value_type &value : shards_[i].map) fn(value);
+    }
+  }
+
+  hasher hash_function() const { return hash_; }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  struct alignas(kCacheLine) Shard {
+    Shard(const hasher &hash, const key_equal &equal,
+          const allocator_type &alloc)
+        : map(0, hash, equal, alloc) {}
+
+    mutable std::shared_mutex mutex;
+    shard_type map;
+  };
+
+  // The shard comes from the top bits of a multiplicative hash, which the
+  // tables inside the shards do not look at, so keys stay spread within
+  // each shard too.
+  size_type ShardIndex(const key_type &key) const {
+    if (!shard_bits_) return 0;
+    uint64_t hash = static_cast<uint64_t>(hash_(key)) * 0xC2B2AE3D27D4EB4Full;
+    return static_cast<size_type>(hash >> (64 - shard_bits_));
+  }
+
+  Shard &ShardOf(const key_type &key) { return shards_[ShardIndex(key)]; }
+  const Shard &ShardOf(const key_type &key) const {
+    return shards_[ShardIndex(key)];
+  }
+
+  hasher hash_;
+  size_type shard_bits_ = 0;
+  // A deque builds the shards in place; a shared_mutex cannot be moved.
+  std::deque<Shard> shards_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_CONCURRENT_MAP_H
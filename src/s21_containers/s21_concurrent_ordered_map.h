@@ -0,0 +1,528 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_CONCURRENT_ORDERED_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_CONCURRENT_ORDERED_MAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include "../binary_tree/s21_epoch.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// An ordered map that any number of threads can read, write and scan at
+// once without locks: a skip list whose links are changed by compare and
+// swap. An erase first marks the element's links, which makes it gone, and
+// then unlinks it; any thread that runs into a marked element on its way
+// helps unlinking it. Erased elements are freed by epoch-based
+// reclamation, only once no thread can still be looking at them.
+//
+// Iterators are weakly consistent: one keeps the element it points to
+// alive, never skips an element that is there for the whole scan, never
+// shows one twice and may or may not show those inserted or erased while
+// it runs. Values are not synchronized, so there is no insert_or_assign or
+// operator[], and at() returns a copy.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class concurrent_ordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+ private:
+  static constexpr int kMaxHeight = 16;
+
+  using link_type = std::atomic<uintptr_t>;
+
+  // The links follow the node in the same allocation, one per level. The
+  // low bit of a link marks the node it belongs to as erased.
+  struct Node {
+    template <typename... Args>
+    explicit Node(int levels, Args &&...args)
+        : value(std::forward<Args>(args)...),
+          height(static_cast<unsigned char>(levels)) {}
+
+    link_type *Links() noexcept {
+      return reinterpret_cast<link_type *>(this + 1);
+    }
+
+    value_type value;
+    Node *retired_next = nullptr;
+    // The inserter and the eraser each let go once they will not link or
+    // unlink the node any more; the last one retires it.
+    std::atomic<unsigned char> owners{2};
+    unsigned char height;
+  };
+
+  struct alignas(Node) Unit {
+    unsigned char bytes[alignof(Node)];
+  };
+
+  using unit_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Unit>;
+  using reclaimer_type = EpochReclaimer<Node>;
+  using guard_type = typename reclaimer_type::Guard;
+
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = concurrent_ordered_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    iterator() noexcept = default;
+
+    iterator &operator++() noexcept {
+      node_ = Successor(node_);
+      if (!node_) guard_ = guard_type();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    value_type &operator*() const noexcept { return node_->value; }
+    value_type *operator->() const noexcept { return &node_->value; }
+
+    bool operator==(const iterator &other) const noexcept {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const iterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class concurrent_ordered_map;
+
+    // end() pins nothing.
+    iterator(Node *node, guard_type guard) noexcept : node_(node) {
+      if (node_) guard_ = std::move(guard);
+    }
+
+    Node *node_ = nullptr;
+    guard_type guard_;
+  };
+
+  using const_iterator = const iterator;
+
+  concurrent_ordered_map() = default;
+
+  explicit concurrent_ordered_map(
+      const key_compare &compare,
+      const allocator_type &alloc = allocator_type())
+      : compare_(compare), alloc_(alloc) {}
+
+  concurrent_ordered_map(std::initializer_list<value_type> const &items,
+                         const allocator_type &alloc = allocator_type())
+      : alloc_(alloc) {
+    for (const auto &item : items) insert(item);
+  }
+
+  concurrent_ordered_map(const concurrent_ordered_map &) = delete;
+  concurrent_ordered_map &operator=(const concurrent_ordered_map &) = delete;
+
+  // No other thread may use the map any more.
+  ~concurrent_ordered_map() noexcept {
+    Node *node = Unmark(head_[0].load());
+    while (node) {
+      Node *next = Unmark(node->Links()[0].load());
+      DestroyNode(node);
+      node = next;
+    }
+    FreeChain(reclaimer_.TakeAll());
+  }
+
+  mapped_type at(const key_type &key) const {
+    iterator it = find(key);
+
+    if (it == end()) throw std::out_of_range("Key not found");
+    return (*it).second;
+  }
+
+  iterator begin() const {
+    guard_type guard = reclaimer_.Pin();
+    return iterator(FirstFrom(head_), std::move(guard));
+  }
+
+  iterator end() const noexcept { return iterator(); }
+
+  // Both are exact only while no other thread writes.
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    std::ptrdiff_t size = size_.load();
+    return size > 0 ? static_cast<size_type>(size) : 0;
+  }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() /
+           (sizeof(Node) + kMaxHeight * sizeof(link_type));
+  }
+
+  // Erases the elements one by one, so it is safe while other threads run.
+  void clear() {
+    for (iterator it = begin(); it != end(); ++it) Remove(it.node_);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return TryEmplace(value.first, value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return TryEmplace(value.first, std::move(value));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return TryEmplace(key, key, obj);
+  }
+
+  // The element is built before the search, which needs its key.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    guard_type guard = reclaimer_.Pin();
+    Node *node = NewNode(RandomHeight(), std::forward<Args>(args)...);
+    Node *succs[kMaxHeight];
+    link_type *pred_links[kMaxHeight];
+    if (Find(node->value.first, pred_links, succs)) {
+      DestroyNode(node);
+      return {iterator(succs[0], std::move(guard)), false};
+    }
+    return Publish(node, pred_links, succs, std::move(guard));
+  }
+
+  // Leaves args untouched when key is already present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return TryEmplace(key, std::piecewise_construct,
+                      std::forward_as_tuple(key),
+                      std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  // Does nothing if another thread erased the element first.
+  void erase(iterator pos) {
+    if (pos.node_) Remove(pos.node_);
+  }
+
+  size_type erase(const key_type &key) {
+    guard_type guard = reclaimer_.Pin();
+    Node *succs[kMaxHeight];
+    link_type *pred_links[kMaxHeight];
+    if (!Find(key, pred_links, succs)) return 0;
+    return Remove(succs[0]) ? 1 : 0;
+  }
+
+  iterator find(const key_type &key) const {
+    guard_type guard = reclaimer_.Pin();
+    Node *node = LowerBound(key);
+    if (node && compare_(key, node->value.first)) node = nullptr;
+    return iterator(node, std::move(guard));
+  }
+
+  bool contains(const key_type &key) const {
+    guard_type guard = reclaimer_.Pin();
+    Node *node = LowerBound(key);
+    return node && !compare_(key, node->value.first);
+  }
+
+  // The start of a range scan: the first element not before key.
+  iterator lower_bound(const key_type &key) const {
+    guard_type guard = reclaimer_.Pin();
+    return iterator(LowerBound(key), std::move(guard));
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    guard_type guard = reclaimer_.Pin();
+    Node *node = LowerBound(key);
+    if (node && !compare_(key, node->value.first)) node = Successor(node);
+    return iterator(node, std::move(guard));
+  }
+
+  key_compare key_comp() const { return compare_; }
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  // Nodes never move, so every returned iterator stays valid; like any
+  // iterator here, each pins an epoch slot until it is destroyed.
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> results;
+    results.reserve(sizeof...(Args));
+
+    ((results.push_back(insert(std::forward<Args>(args)))), ...);
+
+    return results;
+  }
+
+ private:
+  // The links of the head, which has no value.
+  mutable link_type head_[kMaxHeight] = {};
+  // The tallest node ever linked; searches start at its top level.
+  std::atomic<int> height_{1};
+  // Signed, as an erase may count down before the insert counted up.
+  std::atomic<std::ptrdiff_t> size_{0};
+  mutable reclaimer_type reclaimer_;
+  Compare compare_;
+  Allocator alloc_;
+
+  static bool IsMarked(uintptr_t link) noexcept { return link & 1; }
+
+  static Node *Unmark(uintptr_t link) noexcept {
+    return reinterpret_cast<Node *>(link & ~uintptr_t(1));
+  }
+
+  static uintptr_t LinkTo(Node *node) noexcept {
+    return reinterpret_cast<uintptr_t>(node);
+  }
+
+  static bool IsErased(Node *node) noexcept {
+    return IsMarked(node->Links()[0].load());
+  }
+
+  // The first element after links that is not erased. Links of erased
+  // elements still lead on, and under a pin nothing they lead to is freed.
+  static Node *FirstFrom(link_type *links) noexcept {
+    Node *node = Unmark(links[0].load());
+    while (node && IsErased(node)) node = Unmark(node->Links()[0].load());
+    return node;
+  }
+
+  static Node *Successor(Node *node) noexcept {
+    return FirstFrom(node->Links());
+  }
+
+  // Leaves in succs the first node at each level that is not before key,
+  // and in pred_links the links that lead to it.
+  bool Find(const key_type &key, link_type **pred_links,
+            Node **succs) const {
+    while (!Search(key, pred_links, succs)) {
+    }
+    return succs[0] && !compare_(key, succs[0]->value.first);
+  }
+
+  // One pass of Find. Each level starts from the last node before key on
+  // the level above, and marked nodes met on the way are unlinked; when
+  // that fails because the list changed under it, the pass gives up.
+  bool Search(const key_type &key, link_type **pred_links,
+              Node **succs) const {
+    link_type *links = head_;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+      if (level >= height_.load(std::memory_order_relaxed)) {
+        pred_links[level] = links;
+        succs[level] = nullptr;
+        continue;
+      }
+      Node *curr = Unmark(links[level].load());
+      while (curr) {
+        uintptr_t next = curr->Links()[level].load();
+        if (IsMarked(next)) {
+          uintptr_t expected = LinkTo(curr);
+          if (!links[level].compare_exchange_strong(expected,
+                                                    next & ~uintptr_t(1)))
+            return false;
+          curr = Unmark(next);
+          continue;
+        }
+        if (!compare_(curr->value.first, key)) break;
+        links = curr->Links();
+        curr = Unmark(next);
+      }
+      pred_links[level] = links;
+      succs[level] = curr;
+    }
+    return true;
+  }
+
+  Node *LowerBound(const key_type &key) const {
+    Node *succs[kMaxHeight];
+    link_type *pred_links[kMaxHeight];
+    Find(key, pred_links, succs);
+    return succs[0];
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> TryEmplace(const key_type &key, Args &&...args) {
+    guard_type guard = reclaimer_.Pin();
+    Node *succs[kMaxHeight];
+    link_type *pred_links[kMaxHeight];
+    if (Find(key, pred_links, succs))
+      return {iterator(succs[0], std::move(guard)), false};
+    Node *node = NewNode(RandomHeight(), std::forward<Args>(args)...);
+    return Publish(node, pred_links, succs, std::move(guard));
+  }
+
+  // Links node in at the bottom level, which is when it joins the map, and
+  // then level by level upwards, searching again whenever a link changed
+  // under it. An erase that catches it half linked stops the climb.
+  std::pair<iterator, bool> Publish(Node *node, link_type **pred_links,
+                                    Node **succs, guard_type guard) {
+    const key_type &key = node->value.first;
+    link_type *links = node->Links();
+    for (;;) {
+      for (int level = 0; level < node->height; ++level)
+        links[level].store(LinkTo(succs[level]));
+      uintptr_t expected = LinkTo(succs[0]);
+      if (pred_links[0][0].compare_exchange_strong(expected, LinkTo(node)))
+        break;
+      if (Find(key, pred_links, succs)) {
+        DestroyNode(node);
+        return {iterator(succs[0], std::move(guard)), false};
+      }
+    }
+    size_.fetch_add(1);
+    for (int height = height_.load(); height < node->height;)
+      height_.compare_exchange_weak(height, node->height);
+
+    for (int level = 1; level < node->height; ++level) {
+      bool linked = false;
+      while (!linked) {
+        uintptr_t next = links[level].load();
+        if (IsMarked(next)) break;
+        // Only an erase changes the node's links now, and only by marking.
+        if (next != LinkTo(succs[level]) &&
+            !links[level].compare_exchange_strong(next, LinkTo(succs[level])))
+          break;
+        uintptr_t expected = LinkTo(succs[level]);
+        linked = pred_links[level][level].compare_exchange_strong(
+            expected, LinkTo(node));
+        if (!linked) Find(key, pred_links, succs);
+      }
+      if (!linked) break;
+    }
+
+    // An erase that ran while the climb went on may have missed the levels
+    // linked after it looked.
+    if (IsErased(node)) Unlink(node);
+    Release(node);
+    return {iterator(node, std::move(guard)), true};
+  }
+
+  // Marks the links top down and the bottom one last; whoever marks that
+  // one erased the element.
+  bool Remove(Node *node) {
+    guard_type guard = reclaimer_.Pin();
+    link_type *links = node->Links();
+    for (int level = node->height - 1; level >= 0; --level) {
+      uintptr_t next = links[level].load();
+      while (!IsMarked(next)) {
+        if (links[level].compare_exchange_weak(next, next | 1)) {
+          if (level == 0) {
+            size_.fetch_sub(1);
+            Unlink(node);
+            Release(node);
+            return true;
+          }
+          break;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Takes node out of every level it is linked into. Nodes with an equal
+  // key may sit before it on a level, from an insert that followed the
+  // erase, so the search steps through them rather than stopping.
+  void Unlink(Node *node) {
+    while (!TryUnlink(node)) {
+    }
+  }
+
+  // One pass of Unlink; false when the list changed under it.
+  bool TryUnlink(Node *node) {
+    const key_type &key = node->value.first;
+    link_type *links = head_;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+      link_type *pred = links;
+      Node *curr = Unmark(pred[level].load());
+      while (curr && !compare_(key, curr->value.first)) {
+        uintptr_t next = curr->Links()[level].load();
+        if (IsMarked(next)) {
+          uintptr_t expected = LinkTo(curr);
+          if (!pred[level].compare_exchange_strong(expected,
+                                                   next & ~uintptr_t(1)))
+            return false;
+        } else {
+          if (compare_(curr->value.first, key)) links = curr->Links();
+          pred = curr->Links();
+        }
+        curr = Unmark(next);
+      }
+    }
+    return true;
+  }
+
+  void Release(Node *node) {
+    if (node->owners.fetch_sub(1) == 1) FreeChain(reclaimer_.Retire(node));
+  }
+
+  void FreeChain(Node *node) noexcept {
+    while (node) {
+      Node *next = node->retired_next;
+      DestroyNode(node);
+      node = next;
+    }
+  }
+
+  // A quarter of the nodes reach each next level.
+  static int RandomHeight() noexcept {
+    thread_local uint64_t state =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    int height = 1 + __builtin_ctzll(state | (uint64_t(1) << 62)) / 2;
+    return height < kMaxHeight ? height : kMaxHeight;
+  }
+
+  static size_type UnitsFor(int height) noexcept {
+    return (sizeof(Node) + height * sizeof(link_type) + sizeof(Unit) - 1) /
+           sizeof(Unit);
+  }
+
+  template <typename... Args>
+  Node *NewNode(int height, Args &&...args) {
+    unit_allocator alloc(alloc_);
+    Unit *units = std::allocator_traits<unit_allocator>::allocate(
+        alloc, UnitsFor(height));
+    Node *node;
+    try {
+      node = new (units) Node(height, std::forward<Args>(args)...);
+    } catch (...) {
+      std::allocator_traits<unit_allocator>::deallocate(alloc, units,
+                                                        UnitsFor(height));
+      throw;
+    }
+    for (int level = 0; level < height; ++level)
+      new (&node->Links()[level]) link_type(0);
+    return node;
+  }
+
+  void DestroyNode(Node *node) noexcept {
+    int height = node->height;
+    node->~Node();
+    unit_allocator alloc(alloc_);
+    std::allocator_traits<unit_allocator>::deallocate(
+        alloc, reinterpret_cast<Unit *>(node), UnitsFor(height));
+  }
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_CONCURRENT_ORDERED_MAP_H
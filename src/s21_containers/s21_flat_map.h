@@ -0,0 +1,511 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "../binary_tree/s21_binary_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// A map kept as two s21::vectors in the same order, sorted keys in one and
+// their values in the other, so a binary search only touches keys. Bulk
+// construction sorts and deduplicates once; a single insert or erase shifts
+// everything after it, which suits maps that are built up front and then
+// mostly read. Any insert or erase invalidates every iterator and every
+// reference to an element.
+//
+// Keys and values are not stored as pairs, so dereferencing an iterator
+// yields a pair of references, std::pair<const Key &, T &>.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class flat_map {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  // Whether the columns can move without moving elements one by one.
+  static constexpr bool kNothrowMove =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+  using key_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Key>;
+  using mapped_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = std::pair<const key_type &, mapped_type &>;
+  using const_reference = reference;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using key_container_type = s21::vector<key_type, key_allocator>;
+  using mapped_container_type = s21::vector<mapped_type, mapped_allocator>;
+  using size_type = std::size_t;
+
+  class iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = flat_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = flat_map::reference;
+
+    // operator-> hands out a pointer to a pair it holds itself.
+    struct pointer {
+      reference pair;
+      reference *operator->() noexcept { return &pair; }
+    };
+
+    iterator() noexcept = default;
+
+    reference operator*() const noexcept {
+      return {keys_[index_], values_[index_]};
+    }
+    pointer operator->() const noexcept { return {**this}; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    iterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    iterator operator++(int) noexcept {
+      iterator old = *this;
+      ++index_;
+      return old;
+    }
+    iterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+    iterator operator--(int) noexcept {
+      iterator old = *this;
+      --index_;
+      return old;
+    }
+
+    iterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    iterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    iterator operator+(difference_type n) const noexcept {
+      return iterator(keys_, values_, index_ + n);
+    }
+    iterator operator-(difference_type n) const noexcept {
+      return iterator(keys_, values_, index_ - n);
+    }
+    difference_type operator-(const iterator &other) const noexcept {
+      return index_ - other.index_;
+    }
+
+    bool operator==(const iterator &other) const noexcept {
+      return index_ == other.index_;
+    }
+    bool operator!=(const iterator &other) const noexcept {
+      return index_ != other.index_;
+    }
+    bool operator<(const iterator &other) const noexcept {
+      return index_ < other.index_;
+    }
+
+   private:
+    friend class flat_map;
+
+    iterator(const key_type *keys, mapped_type *values,
+             difference_type index) noexcept
+        : keys_(keys), values_(values), index_(index) {}
+
+    const key_type *keys_ = nullptr;
+    mapped_type *values_ = nullptr;
+    difference_type index_ = 0;
+  };
+
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = reverse_iterator;
+
+  flat_map() noexcept = default;
+
+  explicit flat_map(const key_compare &compare,
+                    const allocator_type &alloc = allocator_type())
+      : keys_(key_allocator(alloc)),
+        values_(mapped_allocator(alloc)),
+        compare_(compare) {}
+
+  explicit flat_map(const allocator_type &alloc)
+      : flat_map(key_compare(), alloc) {}
+
+  flat_map(std::initializer_list<value_type> const &items,
+           const allocator_type &alloc = allocator_type())
+      : flat_map(key_compare(), alloc) {
+    insert(items.begin(), items.end());
+  }
+
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last,
+           const key_compare &compare = key_compare(),
+           const allocator_type &alloc = allocator_type())
+      : flat_map(compare, alloc) {
+    insert(first, last);
+  }
+
+  // Takes [first, last) as it is after checking that its keys are sorted
+  // and unique; throws std::invalid_argument otherwise.
+  template <typename InputIt>
+  flat_map(sorted_unique_t, InputIt first, InputIt last,
+           const key_compare &compare = key_compare(),
+           const allocator_type &alloc = allocator_type())
+      : flat_map(compare, alloc) {
+    for (; first != last; ++first) {
+      if (!keys_.empty() && !compare_(keys_.back(), (*first).first))
+        throw std::invalid_argument("flat_map: input is not sorted");
+      keys_.push_back((*first).first);
+      values_.push_back((*first).second);
+    }
+  }
+
+  flat_map(const flat_map &m) = default;
+  flat_map(flat_map &&m) noexcept = default;
+  ~flat_map() noexcept = default;
+
+  // Should copying either column throw, the map is left empty.
+  flat_map &operator=(const flat_map &m) {
+    if (this != &m) {
+      try {
+        keys_ = m.keys_;
+        values_ = m.values_;
+      } catch (...) {
+        clear();
+        throw;
+      }
+      compare_ = m.compare_;
+    }
+    return *this;
+  }
+
+  // Moves the elements one by one, which allocates, when the allocator
+  // does not propagate and the two compare unequal; should that throw,
+  // both maps are left empty.
+  flat_map &operator=(flat_map &&m) noexcept(kNothrowMove) {
+    if (this != &m) {
+      if constexpr (kNothrowMove) {
+        keys_ = std::move(m.keys_);
+        values_ = std::move(m.values_);
+      } else {
+        try {
+          keys_ = std::move(m.keys_);
+          values_ = std::move(m.values_);
+        } catch (...) {
+          clear();
+          m.clear();
+          throw;
+        }
+      }
+      compare_ = std::move(m.compare_);
+    }
+    return *this;
+  }
+
+  mapped_type &at(const key_type &key) const { return At(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  mapped_type &at(const K &key) const {
+    return At(key);
+  }
+
+  // Inserts a value-initialized element when key is missing.
+  mapped_type &operator[](const key_type &key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  mapped_type &operator[](key_type &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
+  iterator begin() const noexcept { return MakeIterator(0); }
+  iterator end() const noexcept { return MakeIterator(keys_.size()); }
+  reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept {
+    return std::min(keys_.max_size(), values_.max_size());
+  }
+
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  void reserve(size_type count) {
+    keys_.reserve(count);
+    values_.reserve(count);
+  }
+
+  // The sorted keys and, in the same order, their values.
+  const key_type *keys() const noexcept { return keys_.data(); }
+  const mapped_type *values() const noexcept { return values_.data(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return try_emplace(key, obj);
+  }
+
+  // Appends the whole range, then sorts by key and drops duplicate keys
+  // once instead of shifting for every element. Elements already in the map
+  // win over equivalent ones from the range, and earlier ones in the range
+  // over later ones.
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last) {
+    s21::vector<value_type> added;
+    for (; first != last; ++first) added.push_back(value_type(*first));
+
+    value_type *data = added.data();
+    std::stable_sort(data, data + added.size(),
+                     [this](const value_type &lhs, const value_type &rhs) {
+                       return compare_(lhs.first, rhs.first);
+                     });
+    if (keys_.empty()) {
+      reserve(added.size());
+      for (size_type i = 0; i < added.size(); ++i) {
+        if (!keys_.empty() && !compare_(keys_.back(), data[i].first)) continue;
+        Append(std::move(data[i].first), std::move(data[i].second));
+      }
+    } else {
+      MergeSorted(data, data + added.size());
+    }
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result = try_emplace(std::move(key), std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+
+  // Leaves args untouched when key is already present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return TryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) {
+    key_type *keys = keys_.data();
+    mapped_type *values = values_.data();
+    size_type size = keys_.size();
+    std::move(keys + pos.index_ + 1, keys + size, keys + pos.index_);
+    std::move(values + pos.index_ + 1, values + size, values + pos.index_);
+    keys_.pop_back();
+    values_.pop_back();
+  }
+
+  void swap(flat_map &other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(compare_, other.compare_);
+  }
+
+  iterator find(const key_type &key) const noexcept { return Find(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return Find(key);
+  }
+
+  bool contains(const key_type &key) const noexcept {
+    return Find(key) != end();
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return Find(key) != end();
+  }
+
+  iterator lower_bound(const key_type &key) const noexcept {
+    return MakeIterator(LowerBound(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return MakeIterator(LowerBound(key));
+  }
+
+  iterator upper_bound(const key_type &key) const noexcept {
+    return MakeIterator(UpperBound(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return MakeIterator(UpperBound(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(
+      const key_type &key) const noexcept {
+    return {MakeIterator(LowerBound(key)), MakeIterator(UpperBound(key))};
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return {MakeIterator(LowerBound(key)), MakeIterator(UpperBound(key))};
+  }
+
+  key_compare key_comp() const { return compare_; }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(keys_.get_allocator());
+  }
+
+ private:
+  key_container_type keys_;
+  mapped_container_type values_;
+  Compare compare_;
+
+  iterator MakeIterator(size_type index) const noexcept {
+    return iterator(keys_.data(), const_cast<mapped_type *>(values_.data()),
+                    static_cast<std::ptrdiff_t>(index));
+  }
+
+  template <typename K>
+  mapped_type &At(const K &key) const {
+    iterator it = Find(key);
+
+    if (it == end()) throw std::out_of_range("Key not found");
+    return (*it).second;
+  }
+
+  // The new element is appended and rotated into place.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(K &&key, Args &&...args) {
+    size_type index = LowerBound(key);
+    if (index < keys_.size() && !compare_(key, keys_.data()[index]))
+      return {MakeIterator(index), false};
+
+    Append(std::forward<K>(key), mapped_type(std::forward<Args>(args)...));
+    key_type *keys = keys_.data();
+    mapped_type *values = values_.data();
+    size_type size = keys_.size();
+    std::rotate(keys + index, keys + size - 1, keys + size);
+    std::rotate(values + index, values + size - 1, values + size);
+    return {MakeIterator(index), true};
+  }
+
+  // Adds a key and its value at the end, both or neither.
+  template <typename K, typename M>
+  void Append(K &&key, M &&obj) {
+    keys_.push_back(std::forward<K>(key));
+    try {
+      values_.push_back(std::forward<M>(obj));
+    } catch (...) {
+      keys_.pop_back();
+      throw;
+    }
+  }
+
+  // Merges elements sorted by key with the map's own in one pass into new
+  // vectors reserved up front, so the only copies that can throw are of
+  // elements whose move could throw, and the map is unchanged if they do.
+  void MergeSorted(value_type *first, value_type *last) {
+    flat_map merged(compare_, get_allocator());
+    merged.reserve(keys_.size() + static_cast<size_type>(last - first));
+
+    key_type *keys = keys_.data();
+    mapped_type *values = values_.data();
+    size_type mine = 0, size = keys_.size();
+    for (value_type *it = first; mine < size || it != last;) {
+      if (it == last || (mine < size && !compare_(it->first, keys[mine]))) {
+        if (it != last && !compare_(keys[mine], it->first)) ++it;
+        merged.Append(std::move_if_noexcept(keys[mine]),
+                      std::move_if_noexcept(values[mine]));
+        ++mine;
+      } else {
+        if (merged.empty() || compare_(merged.keys_.back(), it->first))
+          merged.Append(std::move(it->first), std::move(it->second));
+        ++it;
+      }
+    }
+    swap(merged);
+  }
+
+  template <typename K>
+  iterator Find(const K &key) const noexcept {
+    size_type index = LowerBound(key);
+    if (index < keys_.size() && !compare_(key, keys_.data()[index]))
+      return MakeIterator(index);
+    return end();
+  }
+
+  template <typename K>
+  size_type LowerBound(const K &key) const noexcept {
+    const key_type *keys = keys_.data();
+    return static_cast<size_type>(
+        std::lower_bound(keys, keys + keys_.size(), key,
+                         [this](const key_type &element, const K &target) {
+                           return compare_(element, target);
+                         }) -
+        keys);
+  }
+
+  template <typename K>
+  size_type UpperBound(const K &key) const noexcept {
+    const key_type *keys = keys_.data();
+    return static_cast<size_type>(
+        std::upper_bound(keys, keys + keys_.size(), key,
+                         [this](const K &target, const key_type &element) {
+                           return compare_(target, element);
+                         }) -
+        keys);
+  }
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_map =
+    s21::flat_map<Key, T, Compare,
+                  std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
@@ -0,0 +1,280 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+
+#include "../binary_tree/s21_binary_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// A set kept as one sorted s21::vector: no allocation per element, lookups
+// by binary search over contiguous keys, and iterators that are plain
+// pointers. Building from a range sorts and deduplicates once; a single
+// insert or erase shifts the elements after it, so the type suits sets
+// that are built up front and then mostly read. Any insert or erase
+// invalidates every iterator.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+class flat_set {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using container_type = s21::vector<key_type, allocator_type>;
+  using iterator = const value_type *;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = reverse_iterator;
+  using size_type = std::size_t;
+
+  flat_set() noexcept = default;
+
+  explicit flat_set(const key_compare &compare,
+                    const allocator_type &alloc = allocator_type())
+      : keys_(alloc), compare_(compare) {}
+
+  explicit flat_set(const allocator_type &alloc) : keys_(alloc) {}
+
+  flat_set(std::initializer_list<value_type> const &items,
+           const allocator_type &alloc = allocator_type())
+      : keys_(alloc) {
+    insert(items.begin(), items.end());
+  }
+
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last,
+           const key_compare &compare = key_compare(),
+           const allocator_type &alloc = allocator_type())
+      : keys_(alloc), compare_(compare) {
+    insert(first, last);
+  }
+
+  // Takes [first, last) as it is after checking that it is sorted and free
+  // of duplicates; throws std::invalid_argument otherwise.
+  template <typename InputIt>
+  flat_set(sorted_unique_t, InputIt first, InputIt last,
+           const key_compare &compare = key_compare(),
+           const allocator_type &alloc = allocator_type())
+      : keys_(alloc), compare_(compare) {
+    for (; first != last; ++first) {
+      if (!keys_.empty() && !compare_(keys_.back(), *first))
+        throw std::invalid_argument("flat_set: input is not sorted");
+      keys_.push_back(*first);
+    }
+  }
+
+  flat_set(const flat_set &s) = default;
+  flat_set(flat_set &&s) noexcept = default;
+  ~flat_set() noexcept = default;
+
+  flat_set &operator=(const flat_set &s) {
+    if (this != &s) {
+      keys_ = s.keys_;
+      compare_ = s.compare_;
+    }
+    return *this;
+  }
+
+  // Moves the keys one by one, which allocates, when the allocator does not
+  // propagate and the two compare unequal.
+  flat_set &operator=(flat_set &&s) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &s) {
+      keys_ = std::move(s.keys_);
+      compare_ = std::move(s.compare_);
+    }
+    return *this;
+  }
+
+  iterator begin() const noexcept { return keys_.data(); }
+  iterator end() const noexcept { return keys_.data() + keys_.size(); }
+  reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept { return keys_.max_size(); }
+
+  void clear() noexcept { keys_.clear(); }
+  void reserve(size_type count) { keys_.reserve(count); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return Insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return Insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return Insert(value_type(std::forward<Args>(args)...));
+  }
+
+  // Appends the whole range, then sorts and drops duplicates once instead
+  // of shifting for every element. Elements already in the set win over
+  // equivalent ones from the range, and earlier ones in the range over
+  // later ones.
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last) {
+    size_type old_size = keys_.size();
+    try {
+      for (; first != last; ++first) keys_.push_back(*first);
+    } catch (...) {
+      while (keys_.size() > old_size) keys_.pop_back();
+      throw;
+    }
+
+    key_type *data = keys_.data();
+    auto less = [this](const key_type &lhs, const key_type &rhs) {
+      return compare_(lhs, rhs);
+    };
+    std::stable_sort(data + old_size, data + keys_.size(), less);
+    std::inplace_merge(data, data + old_size, data + keys_.size(), less);
+    key_type *unique_end =
+        std::unique(data, data + keys_.size(),
+                    [this](const key_type &lhs, const key_type &rhs) {
+                      return !compare_(lhs, rhs);
+                    });
+    while (keys_.size() > static_cast<size_type>(unique_end - data))
+      keys_.pop_back();
+  }
+
+  void erase(iterator pos) {
+    key_type *data = keys_.data();
+    key_type *target = data + (pos - begin());
+    std::move(target + 1, data + keys_.size(), target);
+    keys_.pop_back();
+  }
+
+  void swap(flat_set &other) noexcept {
+    keys_.swap(other.keys_);
+    std::swap(compare_, other.compare_);
+  }
+
+  iterator find(const Key &key) const noexcept { return Find(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return Find(key);
+  }
+
+  bool contains(const Key &key) const noexcept { return Find(key) != end(); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return Find(key) != end();
+  }
+
+  iterator lower_bound(const Key &key) const noexcept {
+    return LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return LowerBound(key);
+  }
+
+  iterator upper_bound(const Key &key) const noexcept {
+    return UpperBound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return UpperBound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const Key &key) const noexcept {
+    return {LowerBound(key), UpperBound(key)};
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return {LowerBound(key), UpperBound(key)};
+  }
+
+  key_compare key_comp() const { return compare_; }
+
+  allocator_type get_allocator() const noexcept {
+    return keys_.get_allocator();
+  }
+
+  // The returned iterators are only valid if no later argument inserted.
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> results;
+    results.reserve(sizeof...(Args));
+
+    ((results.push_back(insert(std::forward<Args>(args)))), ...);
+
+    return results;
+  }
+
+ private:
+  container_type keys_;
+  Compare compare_;
+
+  // The new key is appended and rotated into place.
+  template <typename V>
+  std::pair<iterator, bool> Insert(V &&value) {
+    iterator position = LowerBound(value);
+    if (position != end() && !compare_(value, *position))
+      return {position, false};
+
+    size_type index = static_cast<size_type>(position - begin());
+    keys_.push_back(std::forward<V>(value));
+    key_type *data = keys_.data();
+    std::rotate(data + index, data + keys_.size() - 1, data + keys_.size());
+    return {begin() + index, true};
+  }
+
+  template <typename K>
+  iterator Find(const K &key) const noexcept {
+    iterator position = LowerBound(key);
+    if (position != end() && !compare_(key, *position)) return position;
+    return end();
+  }
+
+  template <typename K>
+  iterator LowerBound(const K &key) const noexcept {
+    return std::lower_bound(begin(), end(), key,
+                            [this](const key_type &element, const K &target) {
+                              return compare_(element, target);
+                            });
+  }
+
+  template <typename K>
+  iterator UpperBound(const K &key) const noexcept {
+    return std::upper_bound(begin(), end(), key,
+                            [this](const K &target, const key_type &element) {
+                              return compare_(target, element);
+                            });
+  }
+};
+
+namespace pmr {
+template <typename Key, typename Compare = std::less<Key>>
+using flat_set =
+    s21::flat_set<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_SET_H
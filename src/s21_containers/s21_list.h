@@ -6,10 +6,12 @@
 #include <iostream>
 #include <limits>
 #include <list>
+#include <memory>
+#include <memory_resource>
 #include <utility>
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   class ListIterator;
@@ -18,20 +20,28 @@ class list {
   using const_iterator = ListConstIterator;
 
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
 
   list();
-  explicit list(size_type size);
-  list(std::initializer_list<value_type> const &items);
-  list(const list<value_type> &other);
-  list(list<value_type> &&other) noexcept;
+  explicit list(const Allocator &alloc);
+  explicit list(size_type size, const Allocator &alloc = Allocator());
+  list(std::initializer_list<value_type> const &items,
+       const Allocator &alloc = Allocator());
+  list(const list &other);
+  list(list &&other) noexcept;
   ~list();
 
-  list<value_type> &operator=(list<value_type> &&other) noexcept;
+  list &operator=(list &&other) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
 
   void push_back(const_reference data);
+  void push_back(value_type &&data);
   void push_front(const_reference data);
   void pop_front();
   void pop_back();
@@ -81,6 +91,11 @@ class list {
       this->next = next;
       this->prev = prev;
     }
+    node(value_type &&data, node *next, node *prev) {
+      this->data = std::move(data);
+      this->next = next;
+      this->prev = prev;
+    }
   };
   class ListIterator {
    public:
@@ -144,7 +159,7 @@ class list {
       while (it.current != pos.current->prev) {
         ++it;
       }
-      node *new_node = new node(value, pos.current, it.current);
+      node *new_node = CreateNode(value, pos.current, it.current);
       it.current->next = new_node;
       pos.current->prev = new_node;
       size_list_++;
@@ -159,7 +174,7 @@ class list {
     } else {
       node *previous = pos.current->prev;
       node *next = pos.current->next;
-      delete pos.current;
+      DestroyNode(pos.current);
       previous->next = next;
       next->prev = previous;
       size_list_--;
@@ -218,10 +233,33 @@ class list {
   }
 
  private:
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator alloc_;
   node *head_;
   node *tail_;
   node *end_;
   size_type size_list_;
+
+  template <typename U = const_reference>
+  node *CreateNode(U &&data = value_type(), node *next = nullptr,
+                   node *prev = nullptr) {
+    node *memory = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, memory, std::forward<U>(data), next, prev);
+    } catch (...) {
+      node_traits::deallocate(alloc_, memory, 1);
+      throw;
+    }
+    return memory;
+  }
+
+  void DestroyNode(node *current) noexcept {
+    node_traits::destroy(alloc_, current);
+    node_traits::deallocate(alloc_, current, 1);
+  }
   void length_error() {
     if (!size_list_) {
       throw std::length_error("list is empty");
@@ -230,24 +268,42 @@ class list {
   void clear();
 };
 
-template <typename value_type>
-list<value_type> &list<value_type>::operator=(
-    list<value_type> &&other) noexcept {
-  if (this != &other) {
-    clear();
-    size_list_ = std::exchange(other.size_list_, 0);
-    head_ = std::exchange(other.head_, nullptr);
-    tail_ = std::exchange(other.tail_, nullptr);
-    end_ = std::exchange(other.end_, nullptr);
-    other.head_ = other.tail_ = other.end_ = new node();
+template <typename value_type, typename Allocator>
+list<value_type, Allocator> &list<value_type, Allocator>::operator=(
+    list &&other) noexcept(
+    node_traits::propagate_on_container_move_assignment::value ||
+    node_traits::is_always_equal::value) {
+  if (this == &other) return *this;
+
+  if (node_traits::propagate_on_container_move_assignment::value ||
+      alloc_ == other.alloc_) {
+    // other is left with the emptied sentinel of this list, and with its
+    // allocator when that propagates, so nothing is allocated here.
+    while (!empty()) pop_front();
+    tail_ = end_;
+    if constexpr (node_traits::propagate_on_container_move_assignment::value)
+      std::swap(alloc_, other.alloc_);
+    std::swap(size_list_, other.size_list_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(end_, other.end_);
+  } else {
+    // Nodes from an unequal allocator cannot be adopted, so the values are
+    // moved into nodes from this list's allocator.
+    while (!empty()) pop_front();
+    for (node *current = other.head_; current != other.end_;
+         current = current->next)
+      push_back(std::move(current->data));
+    while (!other.empty()) other.pop_front();
   }
   return *this;
 }
 
-template <typename value_type>
-list<value_type>::list(const list<value_type> &other) {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(const list &other)
+    : alloc_(node_traits::select_on_container_copy_construction(other.alloc_)) {
   size_list_ = 0;
-  head_ = tail_ = end_ = new node();
+  head_ = tail_ = end_ = CreateNode();
   node *current_other = other.head_;
   while (current_other != other.end_) {
     push_back(current_other->data);
@@ -255,31 +311,33 @@ list<value_type>::list(const list<value_type> &other) {
   }
 }
 
-template <typename value_type>
-void list<value_type>::swap(list &other) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::swap(list &other) {
+  if constexpr (node_traits::propagate_on_container_swap::value)
+    std::swap(alloc_, other.alloc_);
   std::swap(size_list_, other.size_list_);
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(end_, other.end_);
 }
 
-template <typename value_type>
-void list<value_type>::clear() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::clear() {
   while (!empty()) {
     pop_front();
   }
-  delete end_;
+  DestroyNode(end_);
 }
 
-template <typename value_type>
-void list<value_type>::push_front(const_reference data) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_front(const_reference data) {
   if (!size_list_) {
-    node *current = new node(data, tail_, head_);
+    node *current = CreateNode(data, end_, end_);
     tail_ = head_ = current;
     end_->next = head_;
     end_->prev = tail_;
   } else {
-    node *current = new node(data, head_, end_);
+    node *current = CreateNode(data, head_, end_);
     end_->next = current;
     head_->prev = current;
     head_ = current;
@@ -287,15 +345,31 @@ void list<value_type>::push_front(const_reference data) {
   size_list_++;
 }
 
-template <typename value_type>
-void list<value_type>::push_back(const_reference data) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_back(const_reference data) {
+  if (!size_list_) {
+    node *current = CreateNode(data, end_, end_);
+    tail_ = head_ = current;
+    end_->next = head_;
+    end_->prev = tail_;
+  } else {
+    node *current = CreateNode(data, end_, tail_);
+    tail_->next = current;
+    end_->prev = current;
+    tail_ = current;
+  }
+  size_list_++;
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_back(value_type &&data) {
   if (!size_list_) {
-    node *current = new node(data, tail_, head_);
+    node *current = CreateNode(std::move(data), end_, end_);
     tail_ = head_ = current;
     end_->next = head_;
     end_->prev = tail_;
   } else {
-    node *current = new node(data, end_, tail_);
+    node *current = CreateNode(std::move(data), end_, tail_);
     tail_->next = current;
     end_->prev = current;
     tail_ = current;
@@ -303,15 +377,19 @@ void list<value_type>::push_back(const_reference data) {
   size_list_++;
 }
 
-template <typename value_type>
-list<value_type>::list() {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list() : list(Allocator()) {}
+
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(const Allocator &alloc) : alloc_(alloc) {
   size_list_ = 0;
-  head_ = tail_ = end_ = new node();
+  head_ = tail_ = end_ = CreateNode();
 }
 
-template <typename value_type>
-list<value_type>::list(size_type size) {
-  head_ = tail_ = end_ = new node();
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(size_type size, const Allocator &alloc)
+    : alloc_(alloc) {
+  head_ = tail_ = end_ = CreateNode();
   size_list_ = 0;
   if (size >= max_size()) {
     throw std::out_of_range("Limit of the container is exceeded");
@@ -321,53 +399,56 @@ list<value_type>::list(size_type size) {
   }
 }
 
-template <typename value_type>
-list<value_type>::list(std::initializer_list<value_type> const &items) {
-  head_ = tail_ = end_ = new node();
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : alloc_(alloc) {
+  head_ = tail_ = end_ = CreateNode();
   size_list_ = 0;
   for (value_type element : items) {
     push_back(element);
   }
 }
 
-template <typename value_type>
-list<value_type>::list(list<value_type> &&other) noexcept {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(list &&other) noexcept
+    : alloc_(other.alloc_) {
   size_list_ = std::exchange(other.size_list_, 0);
   head_ = std::exchange(other.head_, nullptr);
   tail_ = std::exchange(other.tail_, nullptr);
   end_ = std::exchange(other.end_, nullptr);
-  other.head_ = other.tail_ = other.end_ = new node();
+  other.head_ = other.tail_ = other.end_ = other.CreateNode();
 }
 
-template <typename value_type>
-list<value_type>::~list() {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::~list() {
   clear();
 }
 
-template <typename value_type>
-void list<value_type>::pop_front() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::pop_front() {
   length_error();
   node *current = head_;
   head_ = head_->next;
-  delete current;
+  DestroyNode(current);
   size_list_--;
   head_->prev = end_;
   end_->next = head_;
 }
 
-template <typename value_type>
-void list<value_type>::pop_back() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::pop_back() {
   length_error();
   node *current = tail_;
   tail_ = tail_->prev;
-  delete current;
+  DestroyNode(current);
   size_list_--;
   tail_->next = end_;
   end_->prev = tail_;
 }
 
-template <typename value_type>
-void list<value_type>::reverse() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::reverse() {
   auto current = head_;
   while (current != end_) {
     auto next_node = current->next;
@@ -381,8 +462,8 @@ void list<value_type>::reverse() {
   end_->prev = tail_;
 }
 
-template <typename value_type>
-void list<value_type>::unique() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::unique() {
   iterator current = begin();
   iterator next(head_->next);
   while (next != end()) {
@@ -398,8 +479,8 @@ void list<value_type>::unique() {
   }
 }
 
-template <typename value_type>
-void list<value_type>::sort() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::sort() {
   if (!empty()) {
     for (iterator i(head_->next); i != end(); ++i) {
       iterator j(i.current->prev);
@@ -417,5 +498,9 @@ void list<value_type>::sort() {
   }
 }
 
+namespace pmr {
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_1_SRC_S21_LIST_H_
@@ -2,15 +2,23 @@
 #define CPP2_S21_CONTAINERS_1_S21_MAP_H
 
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "../binary_tree/s21_binary_tree.h"
+#include "s21_static_map.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>,
+          typename Layout = ranked_layout, typename Stats = no_stats>
 class map {
  public:
   using key_type = Key;
@@ -18,31 +26,60 @@ class map {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RedBlackTree<value_type>::iterator;
-  using const_iterator = typename RedBlackTree<value_type>::const_iterator;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using tree_type = RedBlackTree<value_type, key_type, SelectFirst<value_type>,
+                                 key_compare, allocator_type, Layout,
+                                 Stats>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reverse_iterator = typename tree_type::reverse_iterator;
+  using const_reverse_iterator = typename tree_type::const_reverse_iterator;
   using size_type = std::size_t;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
+  using frozen_type = static_map<Key, T, Compare, Allocator>;
 
   map() noexcept = default;
 
-  map(std::initializer_list<value_type> const &items) noexcept {
-    for (const auto &item : items) {
-      tree_.insert(item);
+  explicit map(const key_compare &compare,
+               const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {}
+
+  explicit map(const allocator_type &alloc) : tree_(key_compare(), alloc) {}
+
+  map(std::initializer_list<value_type> const &items,
+      const allocator_type &alloc = allocator_type())
+      : tree_(key_compare(), alloc) {
+    if (!tree_.assign_if_sorted(items.begin(), items.end())) {
+      for (const auto &item : items) {
+        tree_.insert(item);
+      }
     }
   }
 
-  map(const map &m) noexcept {
-    for (const auto &pair : m) tree_.insert(pair);
+  template <typename InputIt>
+  map(sorted_unique_t, InputIt first, InputIt last,
+      const key_compare &compare = key_compare(),
+      const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {
+    tree_.assign_sorted(first, last);
   }
 
-  map(map &&m) noexcept {
-    tree_.clear();
-    swap(m);
-  }
+  map(const map &m) : tree_(m.tree_) {}
+
+  map(map &&m) noexcept : tree_(std::move(m.tree_)) {}
 
   ~map() noexcept = default;
 
-  map &operator=(map &&m) noexcept {
-    if (this != &m) tree_ = std::move(m.tree_);
+  map &operator=(const map &m) {
+    tree_ = m.tree_;
+    return *this;
+  }
+
+  map &operator=(map &&m) noexcept(
+      std::is_nothrow_move_assignable<tree_type>::value) {
+    tree_ = std::move(m.tree_);
     return *this;
   }
 
@@ -53,16 +90,28 @@ class map {
     return (*it).second;
   }
 
-  mapped_type &operator[](const key_type &key) const {
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  mapped_type &at(const K &key) const {
     iterator it = find(key);
 
     if (it == end()) throw std::out_of_range("Key not found");
-
     return (*it).second;
   }
 
+  // Inserts a value-initialized element when key is missing.
+  mapped_type &operator[](const key_type &key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  mapped_type &operator[](key_type &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
   iterator begin() const noexcept { return tree_.begin(); }
   iterator end() const noexcept { return tree_.end(); }
+  reverse_iterator rbegin() const noexcept { return tree_.rbegin(); }
+  reverse_iterator rend() const noexcept { return tree_.rend(); }
 
   bool empty() const noexcept { return tree_.empty(); }
   size_type size() const noexcept { return tree_.size(); }
@@ -70,63 +119,257 @@ class map {
 
   void clear() noexcept { tree_.clear(); }
 
-  std::pair<iterator, bool> insert(const value_type &value) noexcept {
-    iterator it = find(value.first);
+  // Makes room for count elements in all. With arena_layout, inserting up
+  // to that many then moves no element, so iterators stay valid.
+  void reserve(size_type count) { tree_.reserve(count); }
+
+  // What the map has done so far, in O(1). Only a map made with
+  // counting_stats keeps count. The height is not counted; see height().
+  tree_stats stats() const noexcept { return tree_.stats(); }
+
+  // The longest path down the tree, in nodes. Nothing tracks it, so every
+  // call walks every node in O(n) time. Needs counting_stats too.
+  size_type height() const noexcept { return tree_.height(); }
 
-    if (it != end()) return {it, false};
+  std::pair<iterator, bool> insert(const value_type &value) {
     return tree_.insert(value);
   }
 
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.insert(std::move(value));
+  }
+
   std::pair<iterator, bool> insert(const key_type &key,
-                                   const mapped_type &obj) noexcept {
-    iterator it = find(key);
+                                   const mapped_type &obj) {
+    return tree_.try_emplace(key, key, obj);
+  }
 
-    if (it != end()) return {it, false};
-    return tree_.insert({key, obj});
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = tree_.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
   }
 
-  std::pair<iterator, bool> insert_or_assign(const key_type &key,
-                                             const mapped_type &obj) noexcept {
-    iterator it = find(key);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result = tree_.try_emplace(key, std::move(key), std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
+  }
 
-    if (it != end()) {
-      (*it).second = obj;
-      return {it, false};
-    }
-    return tree_.insert({key, obj});
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  }
+
+  // Leaves args untouched when key is already present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return tree_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.insert(hint, value);
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  }
+
+  insert_return_type insert(node_type &&node) {
+    return tree_.insert(std::move(node));
+  }
+
+  void erase(iterator pos) noexcept { tree_.erase(pos); }
+
+  node_type extract(iterator pos) { return tree_.extract(pos); }
+  node_type extract(const key_type &key) { return tree_.extract(key); }
+
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last);
   }
 
-  void erase(iterator pos) noexcept {
-    iterator it = find((*pos).first);
-    if (it != end()) tree_.erase(*pos);
+  template <typename ForwardIt>
+  void assign_parallel(ForwardIt first, ForwardIt last, unsigned threads = 0) {
+    tree_.assign_parallel(first, last, threads);
   }
 
   void swap(map &other) noexcept { tree_.swap(other.tree_); }
 
-  void merge(map &other) noexcept {
-    for (const auto &pair : other) tree_.insert(pair);
-    other.clear();
+  // Moves the elements of other whose keys are not here yet into this
+  // map by relinking their nodes; the rest stay in other.
+  void merge(map &other) { tree_.merge(other.tree_); }
+
+  // An immutable copy for lookup tables, searched through an Eytzinger
+  // index instead of the tree.
+  frozen_type freeze() const {
+    return frozen_type(sorted_unique, begin(), end(), key_comp(),
+                       get_allocator());
+  }
+
+  iterator find(const key_type &key) const noexcept { return tree_.find(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return tree_.find(key);
   }
 
   bool contains(const key_type &key) const noexcept {
-    iterator it = find(key);
+    return tree_.contains(key);
+  }
 
-    if (it != end()) return true;
-    return false;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
   }
 
- private:
-  RedBlackTree<value_type> tree_;
+  // Looks up every key in [first, last) at once and writes find() of each
+  // to out, in order; the descents are interleaved so that their cache
+  // misses overlap. Returns the end of the output.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return tree_.find_batch(first, last, out);
+  }
+
+  // Like find_batch, but writes contains() of each key.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_batch(ForwardIt first, ForwardIt last,
+                          OutputIt out) const {
+    return tree_.contains_batch(first, last, out);
+  }
 
-  iterator find(const key_type &key) const noexcept {
-    iterator it = begin();
+  iterator lower_bound(const key_type &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
 
-    while (it != end()) {
-      if ((*it).first == key) return it;
-      ++it;
-    }
-    return end();
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const key_type &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(
+      const key_type &key) const noexcept {
+    return tree_.equal_range(key);
   }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+
+  iterator nth(size_type index) const noexcept { return tree_.nth(index); }
+
+  size_type rank(const key_type &key) const noexcept { return tree_.rank(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type rank(const K &key) const noexcept {
+    return tree_.rank(key);
+  }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+ private:
+  template <typename K, typename V, typename C, typename A, typename L,
+            typename S>
+  friend map<K, V, C, A, L, S> set_union(const map<K, V, C, A, L, S> &,
+                                         const map<K, V, C, A, L, S> &);
+  template <typename K, typename V, typename C, typename A, typename L,
+            typename S>
+  friend map<K, V, C, A, L, S> set_intersection(const map<K, V, C, A, L, S> &,
+                                                const map<K, V, C, A, L, S> &);
+  template <typename K, typename V, typename C, typename A, typename L,
+            typename S>
+  friend map<K, V, C, A, L, S> set_difference(const map<K, V, C, A, L, S> &,
+                                              const map<K, V, C, A, L, S> &);
+  template <typename K, typename V, typename C, typename A, typename L,
+            typename S>
+  friend map<K, V, C, A, L, S> symmetric_difference(
+      const map<K, V, C, A, L, S> &, const map<K, V, C, A, L, S> &);
+
+  tree_type tree_;
 };
+
+// Set algebra on the keys of two maps, with the same costs as for s21::set.
+// Where both maps hold a key, the element of lhs is the one kept.
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Layout, typename Stats>
+map<Key, T, Compare, Allocator, Layout, Stats> set_union(
+    const map<Key, T, Compare, Allocator, Layout, Stats> &lhs,
+    const map<Key, T, Compare, Allocator, Layout, Stats> &rhs) {
+  map<Key, T, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                        lhs.get_allocator());
+  result.tree_.assign_union(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Layout, typename Stats>
+map<Key, T, Compare, Allocator, Layout, Stats> set_intersection(
+    const map<Key, T, Compare, Allocator, Layout, Stats> &lhs,
+    const map<Key, T, Compare, Allocator, Layout, Stats> &rhs) {
+  map<Key, T, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                        lhs.get_allocator());
+  result.tree_.assign_intersection(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Layout, typename Stats>
+map<Key, T, Compare, Allocator, Layout, Stats> set_difference(
+    const map<Key, T, Compare, Allocator, Layout, Stats> &lhs,
+    const map<Key, T, Compare, Allocator, Layout, Stats> &rhs) {
+  map<Key, T, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                        lhs.get_allocator());
+  result.tree_.assign_difference(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+          typename Layout, typename Stats>
+map<Key, T, Compare, Allocator, Layout, Stats> symmetric_difference(
+    const map<Key, T, Compare, Allocator, Layout, Stats> &lhs,
+    const map<Key, T, Compare, Allocator, Layout, Stats> &rhs) {
+  map<Key, T, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                        lhs.get_allocator());
+  result.tree_.assign_symmetric_difference(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using map = s21::map<Key, T, Compare,
+                     std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_1_S21_MAP_H
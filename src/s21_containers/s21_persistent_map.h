@@ -0,0 +1,376 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_PERSISTENT_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_PERSISTENT_MAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// An ordered map whose versions share structure. Nodes are immutable and
+// reference-counted: an update copies only the O(log n) nodes on the path
+// to the key and points the copies at the untouched subtrees, so copying
+// the map, or taking a snapshot(), is O(1) and leaves both maps free to
+// change on their own.
+//
+// Different maps may be used from different threads even while they share
+// nodes, and any number of threads may read one map that nobody writes,
+// which is how a snapshot is meant to be handed to readers. The tree is
+// kept weight-balanced, which also gives the size of every subtree for
+// free. Nodes are shared between maps, so they come from operator new
+// rather than from an allocator of one of them.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using size_type = std::size_t;
+
+ private:
+  struct Node;
+
+  // Owns one reference to a node, like an intrusive shared pointer.
+  class NodePtr {
+   public:
+    NodePtr() noexcept = default;
+    explicit NodePtr(Node *node) noexcept : node_(node) {}
+
+    NodePtr(const NodePtr &other) noexcept : node_(other.node_) {
+      if (node_) node_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    NodePtr(NodePtr &&other) noexcept : node_(other.node_) {
+      other.node_ = nullptr;
+    }
+
+    NodePtr &operator=(NodePtr other) noexcept {
+      std::swap(node_, other.node_);
+      return *this;
+    }
+
+    ~NodePtr() noexcept {
+      if (node_ && node_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete node_;
+    }
+
+    Node *get() const noexcept { return node_; }
+    Node *operator->() const noexcept { return node_; }
+    explicit operator bool() const noexcept { return node_; }
+
+   private:
+    Node *node_ = nullptr;
+  };
+
+  struct Node {
+    template <typename V>
+    Node(V &&value, NodePtr left, NodePtr right)
+        : value(std::forward<V>(value)),
+          left(std::move(left)),
+          right(std::move(right)),
+          size(1 + SizeOf(this->left) + SizeOf(this->right)) {}
+
+    value_type value;
+    NodePtr left;
+    NodePtr right;
+    size_type size;
+    std::atomic<size_type> refs{1};
+  };
+
+ public:
+  // Remembers the path from the root, so it needs no parent links, which
+  // shared nodes could not have. Valid while some map still holds the
+  // version it was taken from.
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = persistent_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    iterator() noexcept = default;
+    iterator(const iterator &other) = default;
+    iterator(iterator &&other) noexcept = default;
+
+    iterator &operator=(iterator other) noexcept {
+      path_.swap(other.path_);
+      return *this;
+    }
+
+    iterator &operator++() {
+      const Node *node = Top()->right.get();
+      path_.pop_back();
+      for (; node; node = node->left.get()) path_.push_back(node);
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    const value_type &operator*() const noexcept { return Top()->value; }
+    const value_type *operator->() const noexcept { return &Top()->value; }
+
+    bool operator==(const iterator &other) const noexcept {
+      if (path_.empty() || other.path_.empty())
+        return path_.empty() == other.path_.empty();
+      return Top() == other.Top();
+    }
+
+    bool operator!=(const iterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class persistent_map;
+
+    const Node *Top() const noexcept {
+      return path_.data()[path_.size() - 1];
+    }
+
+    // Only the ancestors the path leaves to the left, those still to come,
+    // are kept.
+    s21::vector<const Node *> path_;
+  };
+
+  using const_iterator = iterator;
+
+  persistent_map() noexcept = default;
+
+  explicit persistent_map(const key_compare &compare) : compare_(compare) {}
+
+  persistent_map(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) insert(item);
+  }
+
+  persistent_map(const persistent_map &m) = default;
+  persistent_map(persistent_map &&m) noexcept = default;
+  persistent_map &operator=(const persistent_map &m) = default;
+  persistent_map &operator=(persistent_map &&m) noexcept = default;
+  ~persistent_map() noexcept = default;
+
+  // This version of the map, for readers, in O(1).
+  persistent_map snapshot() const { return *this; }
+
+  const mapped_type &at(const key_type &key) const {
+    const Node *node = FindNode(key);
+
+    if (!node) throw std::out_of_range("Key not found");
+    return node->value.second;
+  }
+
+  iterator begin() const { return LowerBound(nullptr); }
+  iterator end() const noexcept { return iterator(); }
+
+  bool empty() const noexcept { return !root_; }
+  size_type size() const noexcept { return SizeOf(root_); }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(Node);
+  }
+
+  // Drops this version's reference; other versions keep their nodes.
+  void clear() noexcept { root_ = NodePtr(); }
+
+  // Returns whether the element was inserted; an existing one is kept.
+  bool insert(const value_type &value) {
+    if (FindNode(value.first)) return false;
+    root_ = Insert(root_, value);
+    return true;
+  }
+
+  bool insert(const key_type &key, const mapped_type &obj) {
+    return insert(value_type(key, obj));
+  }
+
+  // Returns whether the element was inserted rather than assigned.
+  template <typename M>
+  bool insert_or_assign(const key_type &key, M &&obj) {
+    if (FindNode(key)) {
+      root_ = Assign(root_, value_type(key, std::forward<M>(obj)));
+      return false;
+    }
+    root_ = Insert(root_, value_type(key, std::forward<M>(obj)));
+    return true;
+  }
+
+  size_type erase(const key_type &key) {
+    if (!FindNode(key)) return 0;
+    root_ = Erase(root_, key);
+    return 1;
+  }
+
+  void swap(persistent_map &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(compare_, other.compare_);
+  }
+
+  iterator find(const key_type &key) const {
+    iterator it = LowerBound(&key);
+    if (it != end() && compare_(key, (*it).first)) return end();
+    return it;
+  }
+
+  bool contains(const key_type &key) const { return FindNode(key); }
+
+  iterator lower_bound(const key_type &key) const { return LowerBound(&key); }
+
+  key_compare key_comp() const { return compare_; }
+
+  template <typename... Args>
+  s21::vector<bool> insert_many(Args &&...args) {
+    s21::vector<bool> results;
+    results.reserve(sizeof...(Args));
+
+    ((results.push_back(insert(std::forward<Args>(args)))), ...);
+
+    return results;
+  }
+
+ private:
+  // A subtree may hold at most kDelta times the elements of its sibling;
+  // a rotation is double when the inner grandchild holds at least kRatio
+  // times the outer one.
+  static constexpr size_type kDelta = 3;
+  static constexpr size_type kRatio = 2;
+
+  NodePtr root_;
+  Compare compare_;
+
+  static size_type SizeOf(const NodePtr &node) noexcept {
+    return node ? node->size : 0;
+  }
+
+  template <typename V>
+  static NodePtr Make(V &&value, NodePtr left, NodePtr right) {
+    return NodePtr(
+        new Node(std::forward<V>(value), std::move(left), std::move(right)));
+  }
+
+  const Node *FindNode(const key_type &key) const {
+    const Node *node = root_.get();
+    while (node) {
+      if (compare_(key, node->value.first))
+        node = node->left.get();
+      else if (compare_(node->value.first, key))
+        node = node->right.get();
+      else
+        return node;
+    }
+    return nullptr;
+  }
+
+  // The first element not before *key, or the first one when key is null.
+  iterator LowerBound(const key_type *key) const {
+    iterator it;
+    for (const Node *node = root_.get(); node;) {
+      if (key && compare_(node->value.first, *key)) {
+        node = node->right.get();
+      } else {
+        it.path_.push_back(node);
+        node = node->left.get();
+      }
+    }
+    return it;
+  }
+
+  // A copy of node with the same key that holds value, rebuilt up the path.
+  NodePtr Assign(const NodePtr &node, value_type &&value) const {
+    if (compare_(value.first, node->value.first))
+      return Make(node->value, Assign(node->left, std::move(value)),
+                  node->right);
+    if (compare_(node->value.first, value.first))
+      return Make(node->value, node->left,
+                  Assign(node->right, std::move(value)));
+    return Make(std::move(value), node->left, node->right);
+  }
+
+  // value's key is known to be missing.
+  NodePtr Insert(const NodePtr &node, const value_type &value) const {
+    if (!node) return Make(value, NodePtr(), NodePtr());
+    if (compare_(value.first, node->value.first))
+      return Balance(node->value, Insert(node->left, value), node->right);
+    return Balance(node->value, node->left, Insert(node->right, value));
+  }
+
+  // key is known to be present.
+  NodePtr Erase(const NodePtr &node, const key_type &key) const {
+    if (compare_(key, node->value.first))
+      return Balance(node->value, Erase(node->left, key), node->right);
+    if (compare_(node->value.first, key))
+      return Balance(node->value, node->left, Erase(node->right, key));
+    return Glue(node->left, node->right);
+  }
+
+  // Joins two balanced siblings around the element taken from the
+  // larger one.
+  static NodePtr Glue(const NodePtr &left, const NodePtr &right) {
+    if (!left) return right;
+    if (!right) return left;
+    if (SizeOf(left) > SizeOf(right)) {
+      const Node *max = left.get();
+      while (max->right) max = max->right.get();
+      return Balance(max->value, RemoveMax(left), right);
+    }
+    const Node *min = right.get();
+    while (min->left) min = min->left.get();
+    return Balance(min->value, left, RemoveMin(right));
+  }
+
+  static NodePtr RemoveMin(const NodePtr &node) {
+    if (!node->left) return node->right;
+    return Balance(node->value, RemoveMin(node->left), node->right);
+  }
+
+  static NodePtr RemoveMax(const NodePtr &node) {
+    if (!node->right) return node->left;
+    return Balance(node->value, node->left, RemoveMax(node->right));
+  }
+
+  // A node for value over left and right, rotated when one of them became
+  // too heavy by a single insert or erase.
+  static NodePtr Balance(const value_type &value, NodePtr left,
+                         NodePtr right) {
+    size_type left_size = SizeOf(left), right_size = SizeOf(right);
+    if (left_size + right_size <= 1)
+      return Make(value, std::move(left), std::move(right));
+    if (right_size > kDelta * left_size)
+      return RotateLeft(value, std::move(left), right);
+    if (left_size > kDelta * right_size)
+      return RotateRight(value, left, std::move(right));
+    return Make(value, std::move(left), std::move(right));
+  }
+
+  static NodePtr RotateLeft(const value_type &value, NodePtr left,
+                            const NodePtr &right) {
+    const NodePtr &inner = right->left;
+    if (SizeOf(inner) < kRatio * SizeOf(right->right))
+      return Make(right->value, Make(value, std::move(left), inner),
+                  right->right);
+    return Make(inner->value, Make(value, std::move(left), inner->left),
+                Make(right->value, inner->right, right->right));
+  }
+
+  static NodePtr RotateRight(const value_type &value, const NodePtr &left,
+                             NodePtr right) {
+    const NodePtr &inner = left->right;
+    if (SizeOf(inner) < kRatio * SizeOf(left->left))
+      return Make(left->value, left->left,
+                  Make(value, inner, std::move(right)));
+    return Make(inner->value, Make(left->value, left->left, inner->left),
+                Make(value, inner->right, std::move(right)));
+  }
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_PERSISTENT_MAP_H
@@ -1,13 +1,16 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_S21_QUEUE_H_
 #define CPP2_S21_CONTAINERS_1_SRC_S21_QUEUE_H_
 
+#include <memory>
+#include <memory_resource>
+
 #include "s21_list.h"
 
 namespace s21 {
-template <typename T>
-class queue : protected s21::list<T> {
+template <typename T, typename Allocator = std::allocator<T>>
+class queue : protected s21::list<T, Allocator> {
  private:
-  using list = s21::list<T>;
+  using list = s21::list<T, Allocator>;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
@@ -19,6 +22,7 @@ class queue : protected s21::list<T> {
   using list::list;
 
   using list::empty;
+  using list::get_allocator;
   using list::size;
   void push(const_reference value) { list::push_back(value); };
   void pop() { list::pop_front(); };
@@ -30,6 +34,11 @@ class queue : protected s21::list<T> {
     }
   }
 };
+
+namespace pmr {
+template <typename T>
+using queue = s21::queue<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_1_SRC_S21_QUEUE_H_
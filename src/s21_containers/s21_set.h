@@ -1,48 +1,86 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_SET_H
 #define CPP2_S21_CONTAINERS_1_S21_SET_H
 
+#include <functional>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
 
 #include "../binary_tree/s21_binary_tree.h"
+#include "s21_static_set.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>,
+          typename Layout = ranked_layout, typename Stats = no_stats>
 class set {
  public:
   using key_type = Key;
   using value_type = key_type;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RedBlackTree<value_type>::iterator;
-  using const_iterator = typename RedBlackTree<value_type>::const_iterator;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using tree_type = RedBlackTree<value_type, key_type, Identity<value_type>,
+                                 key_compare, allocator_type, Layout,
+                                 Stats>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reverse_iterator = typename tree_type::reverse_iterator;
+  using const_reverse_iterator = typename tree_type::const_reverse_iterator;
   using size_type = std::size_t;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
+  using frozen_type = static_set<Key, Compare, Allocator>;
 
   set() noexcept = default;
 
-  set(std::initializer_list<value_type> const &items) {
-    for (const auto &item : items) tree_.insert(item);
-  }
+  explicit set(const key_compare &compare,
+               const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {}
+
+  explicit set(const allocator_type &alloc) : tree_(key_compare(), alloc) {}
 
-  set(const set &s) {
-    for (const auto &pair : s) tree_.insert(pair);
+  set(std::initializer_list<value_type> const &items,
+      const allocator_type &alloc = allocator_type())
+      : tree_(key_compare(), alloc) {
+    if (!tree_.assign_if_sorted(items.begin(), items.end()))
+      for (const auto &item : items) tree_.insert(item);
   }
 
-  set(set &&s) noexcept {
-    tree_.clear();
-    swap(s);
+  template <typename InputIt>
+  set(sorted_unique_t, InputIt first, InputIt last,
+      const key_compare &compare = key_compare(),
+      const allocator_type &alloc = allocator_type())
+      : tree_(compare, alloc) {
+    tree_.assign_sorted(first, last);
   }
 
+  set(const set &s) : tree_(s.tree_) {}
+
+  set(set &&s) noexcept : tree_(std::move(s.tree_)) {}
+
   ~set() noexcept = default;
 
-  set &operator=(set &&s) noexcept {
-    if (this != &s) tree_ = std::move(s.tree_);
+  set &operator=(const set &s) {
+    tree_ = s.tree_;
+    return *this;
+  }
+
+  set &operator=(set &&s) noexcept(
+      std::is_nothrow_move_assignable<tree_type>::value) {
+    tree_ = std::move(s.tree_);
     return *this;
   }
 
   iterator begin() const noexcept { return tree_.begin(); }
   iterator end() const noexcept { return tree_.end(); }
+  reverse_iterator rbegin() const noexcept { return tree_.rbegin(); }
+  reverse_iterator rend() const noexcept { return tree_.rend(); }
 
   bool empty() const noexcept { return tree_.empty(); }
   size_type size() const noexcept { return tree_.size(); }
@@ -52,39 +90,147 @@ class set {
 
   void clear() noexcept { tree_.clear(); }
 
-  std::pair<iterator, bool> insert(const value_type &value) noexcept {
-    iterator it = find(value);
+  // Makes room for count elements in all. With arena_layout, inserting up
+  // to that many then moves no element, so iterators stay valid.
+  void reserve(size_type count) { tree_.reserve(count); }
 
-    if (it != end()) return {it, false};
+  // What the set has done so far, in O(1). Only a set made with
+  // counting_stats keeps count. The height is not counted; see height().
+  tree_stats stats() const noexcept { return tree_.stats(); }
+
+  // The longest path down the tree, in nodes. Nothing tracks it, so every
+  // call walks every node in O(n) time. Needs counting_stats too.
+  size_type height() const noexcept { return tree_.height(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
     return tree_.insert(value);
   }
 
-  void erase(iterator pos) noexcept {
-    iterator it = find(*pos);
-    if (it != end()) tree_.erase(*pos);
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree_.emplace(std::forward<Args>(args)...);
+  }
+
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.insert(hint, value);
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+  }
+
+  insert_return_type insert(node_type &&node) {
+    return tree_.insert(std::move(node));
+  }
+
+  void erase(iterator pos) noexcept { tree_.erase(pos); }
+
+  node_type extract(iterator pos) { return tree_.extract(pos); }
+  node_type extract(const key_type &key) { return tree_.extract(key); }
+
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last);
+  }
+
+  template <typename ForwardIt>
+  void assign_parallel(ForwardIt first, ForwardIt last, unsigned threads = 0) {
+    tree_.assign_parallel(first, last, threads);
   }
 
   void swap(set &other) noexcept { tree_.swap(other.tree_); }
 
-  void merge(set &other) noexcept {
-    for (const auto &pair : other) tree_.insert(pair);
-    other.clear();
+  // Moves the elements of other whose keys are not here yet into this
+  // set by relinking their nodes; the rest stay in other.
+  void merge(set &other) { tree_.merge(other.tree_); }
+
+  // An immutable copy for lookup tables, searched through an Eytzinger
+  // index instead of the tree.
+  frozen_type freeze() const {
+    return frozen_type(sorted_unique, begin(), end(), key_comp(),
+                       get_allocator());
+  }
+
+  iterator find(const Key &key) const noexcept { return tree_.find(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }
+
+  bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }
+
+  // Looks up every key in [first, last) at once and writes find() of each
+  // to out, in order; the descents are interleaved so that their cache
+  // misses overlap. Returns the end of the output.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return tree_.find_batch(first, last, out);
+  }
+
+  // Like find_batch, but writes contains() of each key.
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_batch(ForwardIt first, ForwardIt last,
+                          OutputIt out) const {
+    return tree_.contains_batch(first, last, out);
+  }
+
+  iterator lower_bound(const Key &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+
+  iterator upper_bound(const Key &key) const noexcept {
+    return tree_.upper_bound(key);
   }
 
-  iterator find(const Key &key) const noexcept {
-    iterator it = begin();
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const Key &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+
+  iterator nth(size_type index) const noexcept { return tree_.nth(index); }
+
+  size_type rank(const Key &key) const noexcept { return tree_.rank(key); }
 
-    while (it != end()) {
-      if (*it == key) return it;
-      ++it;
-    }
-    return end();
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type rank(const K &key) const noexcept {
+    return tree_.rank(key);
   }
 
-  bool contains(const Key &key) const noexcept {
-    iterator it = find(key);
-    if (it != end()) return true;
-    return false;
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
   }
 
   template <typename... Args>
@@ -98,7 +244,75 @@ class set {
   }
 
  private:
-  RedBlackTree<value_type> tree_;
+  template <typename K, typename C, typename A, typename L, typename S>
+  friend set<K, C, A, L, S> set_union(const set<K, C, A, L, S> &,
+                                      const set<K, C, A, L, S> &);
+  template <typename K, typename C, typename A, typename L, typename S>
+  friend set<K, C, A, L, S> set_intersection(const set<K, C, A, L, S> &,
+                                             const set<K, C, A, L, S> &);
+  template <typename K, typename C, typename A, typename L, typename S>
+  friend set<K, C, A, L, S> set_difference(const set<K, C, A, L, S> &,
+                                           const set<K, C, A, L, S> &);
+  template <typename K, typename C, typename A, typename L, typename S>
+  friend set<K, C, A, L, S> symmetric_difference(const set<K, C, A, L, S> &,
+                                                 const set<K, C, A, L, S> &);
+
+  tree_type tree_;
 };
+
+// Set algebra over two sets ordered the same way. Each result is built from
+// one linear walk over both inputs; an intersection with a much smaller side,
+// or a difference with a much smaller lhs, searches the larger set for each
+// element of the smaller one instead. The result takes the comparator and
+// allocator of lhs.
+template <typename Key, typename Compare, typename Allocator, typename Layout,
+          typename Stats>
+set<Key, Compare, Allocator, Layout, Stats> set_union(
+    const set<Key, Compare, Allocator, Layout, Stats> &lhs,
+    const set<Key, Compare, Allocator, Layout, Stats> &rhs) {
+  set<Key, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                     lhs.get_allocator());
+  result.tree_.assign_union(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+template <typename Key, typename Compare, typename Allocator, typename Layout,
+          typename Stats>
+set<Key, Compare, Allocator, Layout, Stats> set_intersection(
+    const set<Key, Compare, Allocator, Layout, Stats> &lhs,
+    const set<Key, Compare, Allocator, Layout, Stats> &rhs) {
+  set<Key, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                     lhs.get_allocator());
+  result.tree_.assign_intersection(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+// The elements of lhs that are not in rhs.
+template <typename Key, typename Compare, typename Allocator, typename Layout,
+          typename Stats>
+set<Key, Compare, Allocator, Layout, Stats> set_difference(
+    const set<Key, Compare, Allocator, Layout, Stats> &lhs,
+    const set<Key, Compare, Allocator, Layout, Stats> &rhs) {
+  set<Key, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                     lhs.get_allocator());
+  result.tree_.assign_difference(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+template <typename Key, typename Compare, typename Allocator, typename Layout,
+          typename Stats>
+set<Key, Compare, Allocator, Layout, Stats> symmetric_difference(
+    const set<Key, Compare, Allocator, Layout, Stats> &lhs,
+    const set<Key, Compare, Allocator, Layout, Stats> &rhs) {
+  set<Key, Compare, Allocator, Layout, Stats> result(lhs.key_comp(),
+                                                     lhs.get_allocator());
+  result.tree_.assign_symmetric_difference(lhs.tree_, rhs.tree_);
+  return result;
+}
+
+namespace pmr {
+template <typename Key, typename Compare = std::less<Key>>
+using set = s21::set<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_1_S21_SET_H
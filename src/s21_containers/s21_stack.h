@@ -2,27 +2,35 @@
 #define CPP2_S21_CONTAINERS_1_S21_STACK_H
 
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <utility>
 
 #include "s21_list.h"
 
 namespace s21 {
-template <class T>
+template <class T, class Allocator = std::allocator<T>>
 class stack {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const value_type &;
   using size_type = std::size_t;
 
   stack() = default;
-  stack(std::initializer_list<value_type> const &items) {
+  explicit stack(const Allocator &alloc) : data(alloc) {}
+  stack(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator())
+      : data(alloc) {
     for (const auto &item : items) push(item);
   }
 
   stack(const stack &s) : data(s.data) {}
-  stack(stack &&s) noexcept { data.swap(s.data); }
+  stack(stack &&s) noexcept : data(s.data.get_allocator()) {
+    data.swap(s.data);
+  }
   ~stack() = default;
 
   stack &operator=(stack &&s) noexcept {
@@ -47,14 +55,23 @@ class stack {
 
   void swap(stack &other) { data.swap(other.data); }
 
+  allocator_type get_allocator() const noexcept {
+    return data.get_allocator();
+  }
+
   template <typename... Args>
   void insert_many_front(Args &&...args) {
     (this->push(std::forward<Args>(args)), ...);
   }
 
  private:
-  s21::list<T> data;
+  s21::list<T, Allocator> data;
 };
+
+namespace pmr {
+template <typename T>
+using stack = s21::stack<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_1_S21_STACK_H
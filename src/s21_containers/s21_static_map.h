@@ -0,0 +1,369 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_STATIC_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_STATIC_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../binary_tree/s21_binary_tree.h"
+#include "../binary_tree/s21_eytzinger.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// The map counterpart of static_set, usually made by map::freeze(). Keys and
+// values are kept apart like in flat_map, the keys under an EytzingerIndex
+// and the values in the same order, so lookups only touch keys. Nothing can
+// be inserted, erased or assigned through it; iterators yield a pair of
+// const references.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class static_map {
+  using key_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Key>;
+  using mapped_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = std::pair<const key_type &, const mapped_type &>;
+  using const_reference = reference;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using index_type = EytzingerIndex<key_type, key_compare, key_allocator>;
+  using mapped_container_type = s21::vector<mapped_type, mapped_allocator>;
+  using size_type = std::size_t;
+
+  class iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = static_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = static_map::reference;
+
+    // operator-> hands out a pointer to a pair it holds itself.
+    struct pointer {
+      reference pair;
+      reference *operator->() noexcept { return &pair; }
+    };
+
+    iterator() noexcept = default;
+
+    reference operator*() const noexcept {
+      return {keys_[index_], values_[index_]};
+    }
+    pointer operator->() const noexcept { return {**this}; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    iterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    iterator operator++(int) noexcept {
+      iterator old = *this;
+      ++index_;
+      return old;
+    }
+    iterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+    iterator operator--(int) noexcept {
+      iterator old = *this;
+      --index_;
+      return old;
+    }
+
+    iterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    iterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    iterator operator+(difference_type n) const noexcept {
+      return iterator(keys_, values_, index_ + n);
+    }
+    iterator operator-(difference_type n) const noexcept {
+      return iterator(keys_, values_, index_ - n);
+    }
+    difference_type operator-(const iterator &other) const noexcept {
+      return index_ - other.index_;
+    }
+
+    bool operator==(const iterator &other) const noexcept {
+      return index_ == other.index_;
+    }
+    bool operator!=(const iterator &other) const noexcept {
+      return index_ != other.index_;
+    }
+    bool operator<(const iterator &other) const noexcept {
+      return index_ < other.index_;
+    }
+
+   private:
+    friend class static_map;
+
+    iterator(const key_type *keys, const mapped_type *values,
+             difference_type index) noexcept
+        : keys_(keys), values_(values), index_(index) {}
+
+    const key_type *keys_ = nullptr;
+    const mapped_type *values_ = nullptr;
+    difference_type index_ = 0;
+  };
+
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = reverse_iterator;
+
+  static_map() = default;
+
+  explicit static_map(const key_compare &compare,
+                      const allocator_type &alloc = allocator_type())
+      : index_(compare, key_allocator(alloc)),
+        values_(mapped_allocator(alloc)) {}
+
+  static_map(std::initializer_list<value_type> const &items,
+             const allocator_type &alloc = allocator_type())
+      : static_map(items.begin(), items.end(), key_compare(), alloc) {}
+
+  // Sorts the range by key and keeps the first of equivalent keys.
+  template <typename InputIt>
+  static_map(InputIt first, InputIt last,
+             const key_compare &compare = key_compare(),
+             const allocator_type &alloc = allocator_type())
+      : static_map(SortedColumns(first, last, compare, alloc), compare) {}
+
+  // Takes [first, last) as it is after checking that its keys are sorted
+  // and unique; throws std::invalid_argument otherwise.
+  template <typename InputIt>
+  static_map(sorted_unique_t, InputIt first, InputIt last,
+             const key_compare &compare = key_compare(),
+             const allocator_type &alloc = allocator_type())
+      : static_map(CheckedColumns(first, last, compare, alloc), compare) {}
+
+  static_map(const static_map &m) = default;
+  static_map(static_map &&m) noexcept = default;
+  ~static_map() noexcept = default;
+
+  // Should copying either column throw, the map is left empty.
+  static_map &operator=(const static_map &m) {
+    if (this != &m) {
+      try {
+        index_ = m.index_;
+        values_ = m.values_;
+      } catch (...) {
+        index_.clear();
+        values_.clear();
+        throw;
+      }
+    }
+    return *this;
+  }
+
+  // Moves the elements one by one, which allocates, when the allocator
+  // does not propagate and the two compare unequal; should that throw,
+  // both maps are left empty.
+  static_map &operator=(static_map &&m) noexcept(kNothrowMove) {
+    if (this != &m) {
+      if constexpr (kNothrowMove) {
+        index_ = std::move(m.index_);
+        values_ = std::move(m.values_);
+      } else {
+        try {
+          index_ = std::move(m.index_);
+          values_ = std::move(m.values_);
+        } catch (...) {
+          index_.clear();
+          values_.clear();
+          m.index_.clear();
+          m.values_.clear();
+          throw;
+        }
+      }
+    }
+    return *this;
+  }
+
+  const mapped_type &at(const key_type &key) const { return At(key); }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const mapped_type &at(const K &key) const {
+    return At(key);
+  }
+
+  iterator begin() const noexcept { return MakeIterator(0); }
+  iterator end() const noexcept { return MakeIterator(index_.size()); }
+  reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+  bool empty() const noexcept { return index_.size() == 0; }
+  size_type size() const noexcept { return index_.size(); }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() /
+           (2 * sizeof(key_type) + sizeof(mapped_type));
+  }
+
+  // The sorted keys and, in the same order, their values.
+  const key_type *keys() const noexcept { return index_.keys(); }
+  const mapped_type *values() const noexcept { return values_.data(); }
+
+  void swap(static_map &other) noexcept {
+    index_.swap(other.index_);
+    values_.swap(other.values_);
+  }
+
+  iterator find(const key_type &key) const noexcept {
+    return MakeIterator(index_.Find(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return MakeIterator(index_.Find(key));
+  }
+
+  bool contains(const key_type &key) const noexcept {
+    return index_.Find(key) != index_.size();
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return index_.Find(key) != index_.size();
+  }
+
+  iterator lower_bound(const key_type &key) const noexcept {
+    return MakeIterator(index_.LowerBound(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return MakeIterator(index_.LowerBound(key));
+  }
+
+  iterator upper_bound(const key_type &key) const noexcept {
+    return MakeIterator(index_.UpperBound(key));
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return MakeIterator(index_.UpperBound(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(
+      const key_type &key) const noexcept {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  key_compare key_comp() const { return index_.key_comp(); }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(index_.get_allocator());
+  }
+
+ private:
+  using key_container_type = typename index_type::container_type;
+  using columns_type = std::pair<key_container_type, mapped_container_type>;
+
+  // Whether both columns can move without moving elements one by one.
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_assignable<index_type>::value &&
+      std::is_nothrow_move_assignable<mapped_container_type>::value;
+
+  index_type index_;
+  mapped_container_type values_;
+
+  static_map(columns_type &&columns, const key_compare &compare)
+      : index_(std::move(columns.first), compare),
+        values_(std::move(columns.second)) {}
+
+  iterator MakeIterator(size_type index) const noexcept {
+    return iterator(index_.keys(), values_.data(),
+                    static_cast<std::ptrdiff_t>(index));
+  }
+
+  template <typename K>
+  const mapped_type &At(const K &key) const {
+    size_type index = index_.Find(key);
+
+    if (index == index_.size()) throw std::out_of_range("Key not found");
+    return values_.data()[index];
+  }
+
+  template <typename InputIt>
+  static columns_type SortedColumns(InputIt first, InputIt last,
+                                    const key_compare &compare,
+                                    const allocator_type &alloc) {
+    s21::vector<value_type> items;
+    for (; first != last; ++first) items.push_back(value_type(*first));
+
+    value_type *data = items.data();
+    auto less = [&compare](const value_type &lhs, const value_type &rhs) {
+      return compare(lhs.first, rhs.first);
+    };
+    std::stable_sort(data, data + items.size(), less);
+    value_type *unique_end =
+        std::unique(data, data + items.size(),
+                    [&less](const value_type &lhs, const value_type &rhs) {
+                      return !less(lhs, rhs);
+                    });
+
+    columns_type columns{key_container_type(key_allocator(alloc)),
+                         mapped_container_type(mapped_allocator(alloc))};
+    columns.first.reserve(static_cast<size_type>(unique_end - data));
+    columns.second.reserve(static_cast<size_type>(unique_end - data));
+    for (value_type *item = data; item != unique_end; ++item) {
+      columns.first.push_back(std::move(item->first));
+      columns.second.push_back(std::move(item->second));
+    }
+    return columns;
+  }
+
+  template <typename InputIt>
+  static columns_type CheckedColumns(InputIt first, InputIt last,
+                                     const key_compare &compare,
+                                     const allocator_type &alloc) {
+    columns_type columns{key_container_type(key_allocator(alloc)),
+                         mapped_container_type(mapped_allocator(alloc))};
+    for (; first != last; ++first) {
+      if (!columns.first.empty() &&
+          !compare(columns.first.back(), (*first).first))
+        throw std::invalid_argument("static_map: input is not sorted");
+      columns.first.push_back((*first).first);
+      columns.second.push_back((*first).second);
+    }
+    return columns;
+  }
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using static_map =
+    s21::static_map<Key, T, Compare,
+                    std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_STATIC_MAP_H
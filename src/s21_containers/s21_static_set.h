@@ -0,0 +1,201 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_STATIC_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_STATIC_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../binary_tree/s21_binary_tree.h"
+#include "../binary_tree/s21_eytzinger.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// An immutable set for lookup tables, usually made by set::freeze(). The
+// keys sit in one sorted array, so iteration is a pointer walk, and an
+// EytzingerIndex over them answers lookups with a branchless descent of a
+// few cache lines instead of a chain of dependent node loads. There is no
+// insert or erase; build a new set to change it.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+class static_set {
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using index_type = EytzingerIndex<key_type, key_compare, allocator_type>;
+  using iterator = const value_type *;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = reverse_iterator;
+  using size_type = std::size_t;
+
+  static_set() = default;
+
+  explicit static_set(const key_compare &compare,
+                      const allocator_type &alloc = allocator_type())
+      : index_(compare, alloc) {}
+
+  static_set(std::initializer_list<value_type> const &items,
+             const allocator_type &alloc = allocator_type())
+      : static_set(items.begin(), items.end(), key_compare(), alloc) {}
+
+  // Sorts the range and keeps the first of equivalent keys.
+  template <typename InputIt>
+  static_set(InputIt first, InputIt last,
+             const key_compare &compare = key_compare(),
+             const allocator_type &alloc = allocator_type())
+      : index_(SortedKeys(first, last, compare, alloc), compare) {}
+
+  // Takes [first, last) as it is after checking that it is sorted and free
+  // of duplicates; throws std::invalid_argument otherwise.
+  template <typename InputIt>
+  static_set(sorted_unique_t, InputIt first, InputIt last,
+             const key_compare &compare = key_compare(),
+             const allocator_type &alloc = allocator_type())
+      : index_(CheckedKeys(first, last, compare, alloc), compare) {}
+
+  static_set(const static_set &s) = default;
+  static_set(static_set &&s) noexcept = default;
+  ~static_set() noexcept = default;
+
+  static_set &operator=(const static_set &s) {
+    index_ = s.index_;
+    return *this;
+  }
+
+  // Moves the keys one by one, which allocates, when the allocator does not
+  // propagate and the two compare unequal.
+  static_set &operator=(static_set &&s) noexcept(
+      std::is_nothrow_move_assignable<index_type>::value) {
+    index_ = std::move(s.index_);
+    return *this;
+  }
+
+  iterator begin() const noexcept { return index_.keys(); }
+  iterator end() const noexcept { return index_.keys() + index_.size(); }
+  reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+  bool empty() const noexcept { return index_.size() == 0; }
+  size_type size() const noexcept { return index_.size(); }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / (2 * sizeof(key_type));
+  }
+
+  void swap(static_set &other) noexcept { index_.swap(other.index_); }
+
+  iterator find(const Key &key) const noexcept {
+    return begin() + index_.Find(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const noexcept {
+    return begin() + index_.Find(key);
+  }
+
+  bool contains(const Key &key) const noexcept {
+    return index_.Find(key) != index_.size();
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return index_.Find(key) != index_.size();
+  }
+
+  iterator lower_bound(const Key &key) const noexcept {
+    return begin() + index_.LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const noexcept {
+    return begin() + index_.LowerBound(key);
+  }
+
+  iterator upper_bound(const Key &key) const noexcept {
+    return begin() + index_.UpperBound(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const noexcept {
+    return begin() + index_.UpperBound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const Key &key) const noexcept {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const noexcept {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  key_compare key_comp() const { return index_.key_comp(); }
+
+  allocator_type get_allocator() const noexcept {
+    return index_.get_allocator();
+  }
+
+ private:
+  using container_type = typename index_type::container_type;
+
+  index_type index_;
+
+  template <typename InputIt>
+  static container_type SortedKeys(InputIt first, InputIt last,
+                                   const key_compare &compare,
+                                   const allocator_type &alloc) {
+    container_type keys(alloc);
+    for (; first != last; ++first) keys.push_back(*first);
+
+    key_type *data = keys.data();
+    auto less = [&compare](const key_type &lhs, const key_type &rhs) {
+      return compare(lhs, rhs);
+    };
+    std::stable_sort(data, data + keys.size(), less);
+    key_type *unique_end =
+        std::unique(data, data + keys.size(),
+                    [&less](const key_type &lhs, const key_type &rhs) {
+                      return !less(lhs, rhs);
+                    });
+    while (keys.size() > static_cast<size_type>(unique_end - data))
+      keys.pop_back();
+    return keys;
+  }
+
+  template <typename InputIt>
+  static container_type CheckedKeys(InputIt first, InputIt last,
+                                    const key_compare &compare,
+                                    const allocator_type &alloc) {
+    container_type keys(alloc);
+    for (; first != last; ++first) {
+      if (!keys.empty() && !compare(keys.back(), *first))
+        throw std::invalid_argument("static_set: input is not sorted");
+      keys.push_back(*first);
+    }
+    return keys;
+  }
+};
+
+namespace pmr {
+template <typename Key, typename Compare = std::less<Key>>
+using static_set =
+    s21::static_set<Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_STATIC_SET_H
@@ -0,0 +1,230 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../binary_tree/s21_hash_table.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// s21::map without the order: an open-addressing hash table that finds a
+// key in expected constant time. Insert and erase move elements, so they
+// invalidate every iterator and every reference to an element, and
+// iteration follows the table rather than the keys.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using table_type = HashTable<value_type, key_type, SelectFirst<value_type>,
+                               hasher, key_equal, allocator_type>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = std::size_t;
+
+  unordered_map() noexcept = default;
+
+  explicit unordered_map(size_type bucket_count, const hasher &hash = hasher(),
+                         const key_equal &equal = key_equal(),
+                         const allocator_type &alloc = allocator_type())
+      : table_(hash, equal, alloc) {
+    table_.reserve(bucket_count);
+  }
+
+  explicit unordered_map(const allocator_type &alloc)
+      : table_(hasher(), key_equal(), alloc) {}
+
+  unordered_map(std::initializer_list<value_type> const &items,
+                const allocator_type &alloc = allocator_type())
+      : table_(hasher(), key_equal(), alloc) {
+    table_.reserve(items.size());
+    for (const auto &item : items) table_.insert(item);
+  }
+
+  template <typename InputIt>
+  unordered_map(InputIt first, InputIt last, const hasher &hash = hasher(),
+                const key_equal &equal = key_equal(),
+                const allocator_type &alloc = allocator_type())
+      : table_(hash, equal, alloc) {
+    for (; first != last; ++first) table_.insert(*first);
+  }
+
+  unordered_map(const unordered_map &m)
+      : table_(m.table_, std::allocator_traits<allocator_type>::
+                             select_on_container_copy_construction(
+                                 m.get_allocator())) {}
+
+  unordered_map(unordered_map &&m) noexcept : table_(std::move(m.table_)) {}
+
+  ~unordered_map() noexcept = default;
+
+  unordered_map &operator=(const unordered_map &m) {
+    table_ = m.table_;
+    return *this;
+  }
+
+  unordered_map &operator=(unordered_map &&m) noexcept(
+      std::is_nothrow_move_assignable<table_type>::value) {
+    table_ = std::move(m.table_);
+    return *this;
+  }
+
+  mapped_type &at(const key_type &key) const {
+    iterator it = find(key);
+
+    if (it == end()) throw std::out_of_range("Key not found");
+    return (*it).second;
+  }
+
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  mapped_type &at(const K &key) const {
+    iterator it = find(key);
+
+    if (it == end()) throw std::out_of_range("Key not found");
+    return (*it).second;
+  }
+
+  // Inserts a value-initialized element when key is missing.
+  mapped_type &operator[](const key_type &key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  mapped_type &operator[](key_type &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
+  iterator begin() const noexcept { return table_.begin(); }
+  iterator end() const noexcept { return table_.end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  void clear() noexcept { table_.clear(); }
+
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table_.insert(std::move(value));
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return table_.try_emplace(key, key, obj);
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    auto result = table_.try_emplace(key, key, std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&obj) {
+    auto result =
+        table_.try_emplace(key, std::move(key), std::forward<M>(obj));
+    if (!result.second) (*result.first).second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+
+  // Leaves args untouched when key is already present.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return table_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return table_.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  void erase(iterator pos) { table_.erase(pos); }
+
+  size_type erase(const key_type &key) { return table_.erase(key); }
+
+  void swap(unordered_map &other) noexcept { table_.swap(other.table_); }
+
+  iterator find(const key_type &key) const { return table_.find(key); }
+
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  iterator find(const K &key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const key_type &key) const { return table_.contains(key); }
+
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  bool contains(const K &key) const {
+    return table_.contains(key);
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+
+  allocator_type get_allocator() const noexcept {
+    return table_.get_allocator();
+  }
+
+  // The returned iterators are only valid if no later argument inserted.
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> results;
+    results.reserve(sizeof...(Args));
+
+    ((results.push_back(insert(std::forward<Args>(args)))), ...);
+
+    return results;
+  }
+
+ private:
+  table_type table_;
+};
+
+namespace pmr {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_map = s21::unordered_map<
+    Key, T, Hash, KeyEqual,
+    std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
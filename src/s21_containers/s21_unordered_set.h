@@ -0,0 +1,165 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_UNORDERED_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_UNORDERED_SET_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "../binary_tree/s21_hash_table.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// s21::set without the order: an open-addressing hash table that finds a
+// key in expected constant time. Insert and erase move elements, so they
+// invalidate every iterator, and iteration follows the table rather than
+// the keys.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+class unordered_set {
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using table_type = HashTable<value_type, key_type, Identity<value_type>,
+                               hasher, key_equal, allocator_type>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = std::size_t;
+
+  unordered_set() noexcept = default;
+
+  explicit unordered_set(size_type bucket_count, const hasher &hash = hasher(),
+                         const key_equal &equal = key_equal(),
+                         const allocator_type &alloc = allocator_type())
+      : table_(hash, equal, alloc) {
+    table_.reserve(bucket_count);
+  }
+
+  explicit unordered_set(const allocator_type &alloc)
+      : table_(hasher(), key_equal(), alloc) {}
+
+  unordered_set(std::initializer_list<value_type> const &items,
+                const allocator_type &alloc = allocator_type())
+      : table_(hasher(), key_equal(), alloc) {
+    table_.reserve(items.size());
+    for (const auto &item : items) table_.insert(item);
+  }
+
+  template <typename InputIt>
+  unordered_set(InputIt first, InputIt last, const hasher &hash = hasher(),
+                const key_equal &equal = key_equal(),
+                const allocator_type &alloc = allocator_type())
+      : table_(hash, equal, alloc) {
+    for (; first != last; ++first) table_.insert(*first);
+  }
+
+  unordered_set(const unordered_set &s)
+      : table_(s.table_, std::allocator_traits<allocator_type>::
+                             select_on_container_copy_construction(
+                                 s.get_allocator())) {}
+
+  unordered_set(unordered_set &&s) noexcept : table_(std::move(s.table_)) {}
+
+  ~unordered_set() noexcept = default;
+
+  unordered_set &operator=(const unordered_set &s) {
+    table_ = s.table_;
+    return *this;
+  }
+
+  unordered_set &operator=(unordered_set &&s) noexcept(
+      std::is_nothrow_move_assignable<table_type>::value) {
+    table_ = std::move(s.table_);
+    return *this;
+  }
+
+  iterator begin() const noexcept { return table_.begin(); }
+  iterator end() const noexcept { return table_.end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  void clear() noexcept { table_.clear(); }
+
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table_.insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) { table_.erase(pos); }
+
+  size_type erase(const key_type &key) { return table_.erase(key); }
+
+  void swap(unordered_set &other) noexcept { table_.swap(other.table_); }
+
+  iterator find(const key_type &key) const { return table_.find(key); }
+
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  iterator find(const K &key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const key_type &key) const { return table_.contains(key); }
+
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  bool contains(const K &key) const {
+    return table_.contains(key);
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+
+  allocator_type get_allocator() const noexcept {
+    return table_.get_allocator();
+  }
+
+  // The returned iterators are only valid if no later argument inserted.
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<iterator, bool>> results;
+    results.reserve(sizeof...(Args));
+
+    ((results.push_back(insert(std::forward<Args>(args)))), ...);
+
+    return results;
+  }
+
+ private:
+  table_type table_;
+};
+
+namespace pmr {
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_set = s21::unordered_set<Key, Hash, KeyEqual,
+                                         std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_S21_UNORDERED_SET_H
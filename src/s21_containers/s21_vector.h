@@ -3,15 +3,18 @@
 
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <utility>
 // #include <algorithm>
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class vector {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using pointer = T *;
   using const_reference = const value_type &;
@@ -72,48 +75,90 @@ class vector {
   using iterator = VectorIterator;
   using const_iterator = const VectorIterator;
 
-  vector() : data_(nullptr), size_(0), capacity_(0){};
+  vector() noexcept(noexcept(Allocator())) : vector(Allocator()) {}
+
+  explicit vector(const Allocator &alloc) noexcept
+      : alloc_(alloc), data_(nullptr), size_(0), capacity_(0) {}
 
-  explicit vector(size_type n)
-      : data_(new value_type[n]), size_(n), capacity_(n){};
+  explicit vector(size_type n, const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    reserve(n);
+    for (; size_ < n; ++size_) alloc_traits::construct(alloc_, data_ + size_);
+  }
 
-  vector(std::initializer_list<value_type> const &items)
-      : data_(nullptr), size_(0), capacity_() {
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator())
+      : vector(alloc) {
     reserve(items.size());
-    for (value_type item : items) push_back(item);
+    for (const value_type &item : items) push_back(item);
   }
 
-  vector(const vector &v) : size_(v.size_), capacity_(v.size_) {
-    data_ = new value_type[capacity_];
-    for (size_type i = 0; i < size_; ++i)
-      new (&data_[i]) value_type(v.data_[i]);
+  vector(const vector &v)
+      : vector(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    reserve(v.size_);
+    for (; size_ < v.size_; ++size_)
+      alloc_traits::construct(alloc_, data_ + size_, v.data_[size_]);
   }
 
   vector(vector &&v) noexcept
-      : data_(v.data_), size_(v.size_), capacity_(v.capacity_) {
+      : alloc_(std::move(v.alloc_)),
+        data_(v.data_),
+        size_(v.size_),
+        capacity_(v.capacity_) {
     v.data_ = nullptr;
     v.size_ = v.capacity_ = 0;
   }
 
-  ~vector() noexcept {
-    delete[] data_;
-    data_ = nullptr;
-    size_ = capacity_ = 0;
+  ~vector() noexcept { Deallocate(); }
+
+  // Reuses the storage when it is large enough and the allocator stays.
+  vector &operator=(const vector &v) {
+    if (this == &v) return *this;
+
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      if (alloc_ != v.alloc_) Deallocate();
+      alloc_ = v.alloc_;
+    }
+    clear();
+    reserve(v.size_);
+    for (; size_ < v.size_; ++size_)
+      alloc_traits::construct(alloc_, data_ + size_, v.data_[size_]);
+    return *this;
   }
 
-  vector &operator=(vector &&v) noexcept {
-    if (this != &v) {
-      delete[] data_;
+  vector &operator=(vector &&v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this == &v) return *this;
+
+    if (alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_ == v.alloc_) {
+      Deallocate();
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                        value)
+        alloc_ = std::move(v.alloc_);
       data_ = v.data_;
       size_ = v.size_;
       capacity_ = v.capacity_;
 
       v.data_ = nullptr;
       v.size_ = v.capacity_ = 0;
+    } else {
+      // Memory from an unequal allocator cannot be adopted, so the elements
+      // move one by one into storage from this vector's allocator.
+      clear();
+      reserve(v.size_);
+      for (; size_ < v.size_; ++size_)
+        alloc_traits::construct(alloc_, data_ + size_,
+                                std::move(v.data_[size_]));
+      v.clear();
     }
     return *this;
   }
 
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
   reference at(size_type pos) const {
     if (pos >= this->size_) throw std::out_of_range("Index out of bounds");
     return data_[pos];
@@ -123,6 +168,7 @@ class vector {
   const_reference front() noexcept { return data_[0]; }
   const_reference back() noexcept { return data_[size_ - 1]; }
   pointer data() noexcept { return data_; }
+  const value_type *data() const noexcept { return data_; }
 
   iterator begin() noexcept { return iterator(data_); }
   iterator end() noexcept { return iterator(data_ + size_); }
@@ -138,57 +184,44 @@ class vector {
       throw std::length_error("Size is bigger than max size");
     if (size <= capacity_) return;
 
-    value_type *new_data = new value_type[size];
-    try {
-      std::copy(data_, data_ + size_, new_data);
-    } catch (...) {
-      delete[] new_data;
-      throw;
-    }
-
-    delete[] data_;
-    data_ = new_data;
-    capacity_ = size;
+    Reallocate(size);
   }
 
   size_type capacity() const noexcept { return capacity_; }
 
-  void shrink_to_fit() noexcept {
+  void shrink_to_fit() {
     if (size_ == capacity_) return;
-    if (size_ == 0) {
-      delete[] data_;
-      data_ = nullptr;
-      capacity_ = 0;
-    } else {
-      value_type *new_data = new value_type[size_];
-      for (size_type i = 0; i < size_; ++i) new_data[i] = std::move(data_[i]);
+    if (size_ == 0)
+      Deallocate();
+    else
+      Reallocate(size_);
+  }
 
-      delete[] data_;
-      data_ = new_data;
-      capacity_ = size_;
-    }
+  void clear() noexcept {
+    for (size_type i = 0; i < size_; ++i)
+      alloc_traits::destroy(alloc_, data_ + i);
+    size_ = 0;
   }
 
-  void clear() noexcept { size_ = 0; }
+  iterator insert(iterator pos, const_reference value) {
+    size_type index = 0;
+    for (iterator it = begin(); it < pos; ++it) ++index;
 
-  void insert(iterator pos, const_reference value) noexcept {
-    if (size_ >= capacity_) {
-      size_type new_capacity = (capacity_ == 0) ? 1 : capacity_ * 2;
-      reserve(new_capacity);
-    }
+    value_type copy(value);
+    if (size_ >= capacity_) Grow();
 
-    size_type index = 0;
-    iterator it = begin();
-    while (it <= pos) {
-      ++it;
-      ++index;
+    if (index == size_) {
+      alloc_traits::construct(alloc_, data_ + size_, std::move(copy));
+    } else {
+      alloc_traits::construct(alloc_, data_ + size_,
+                              std::move(data_[size_ - 1]));
+      for (size_type i = size_ - 1; i > index; --i)
+        data_[i] = std::move(data_[i - 1]);
+      data_[index] = std::move(copy);
     }
 
-    for (size_type i = size_; i > index; --i)
-      new (&data_[i]) value_type(std::move(data_[i - 1]));
-
-    new (&data_[index]) value_type(value);
     ++size_;
+    return iterator(data_ + index);
   }
 
   void erase(iterator pos) {
@@ -204,27 +237,42 @@ class vector {
     for (size_type i = index; i < size_ - 1; ++i)
       data_[i] = std::move(data_[i + 1]);
 
-    data_[size_ - 1].~value_type();
+    alloc_traits::destroy(alloc_, data_ + size_ - 1);
     --size_;
   }
 
-  void push_back(const_reference value) noexcept {
+  void push_back(const_reference value) {
     if (size_ >= capacity_) {
-      size_type new_capacity = (capacity_ == 0) ? 1 : capacity_ * 2;
-      reserve(new_capacity);
+      value_type copy(value);
+      Grow();
+      alloc_traits::construct(alloc_, data_ + size_, std::move(copy));
+    } else {
+      alloc_traits::construct(alloc_, data_ + size_, value);
+    }
+    ++size_;
+  }
+
+  void push_back(value_type &&value) {
+    if (size_ >= capacity_) {
+      value_type moved(std::move(value));
+      Grow();
+      alloc_traits::construct(alloc_, data_ + size_, std::move(moved));
+    } else {
+      alloc_traits::construct(alloc_, data_ + size_, std::move(value));
     }
-    data_[size_] = value;
     ++size_;
   }
 
   void pop_back() noexcept {
     if (size_ > 0) {
-      data_[size_ - 1].~value_type();
+      alloc_traits::destroy(alloc_, data_ + size_ - 1);
       --size_;
     }
   }
 
   void swap(vector &other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_swap::value)
+      std::swap(alloc_, other.alloc_);
     std::swap(data_, other.data_);
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
@@ -238,14 +286,51 @@ class vector {
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
     iterator iter(pos);
-    for (auto elem : {std::forward<Args>(args)...}) insert(iter, elem);
-    return iter--;
+    for (auto elem : {std::forward<Args>(args)...}) iter = insert(iter, elem);
+    return iter;
   }
 
  private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  Allocator alloc_;
   value_type *data_;
   size_type size_;
   size_type capacity_;
+
+  void Grow() { reserve((capacity_ == 0) ? 1 : capacity_ * 2); }
+
+  void Reallocate(size_type capacity) {
+    value_type *new_data = alloc_traits::allocate(alloc_, capacity);
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved)
+        alloc_traits::construct(alloc_, new_data + moved,
+                                std::move_if_noexcept(data_[moved]));
+    } catch (...) {
+      while (moved > 0) alloc_traits::destroy(alloc_, new_data + --moved);
+      alloc_traits::deallocate(alloc_, new_data, capacity);
+      throw;
+    }
+
+    size_type size = size_;
+    Deallocate();
+    data_ = new_data;
+    size_ = size;
+    capacity_ = capacity;
+  }
+
+  void Deallocate() noexcept {
+    clear();
+    if (data_) alloc_traits::deallocate(alloc_, data_, capacity_);
+    data_ = nullptr;
+    capacity_ = 0;
+  }
 };
+
+namespace pmr {
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_1_S21_VECTOR_H
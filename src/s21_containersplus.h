@@ -2,5 +2,16 @@
 #define CPP2_S21_CONTAINERS_1_S21_CONTAINERSPLUS_H
 
 #include "s21_containers/s21_array.h"
+#include "s21_containers/s21_btree_map.h"
+#include "s21_containers/s21_btree_set.h"
+#include "s21_containers/s21_concurrent_map.h"
+#include "s21_containers/s21_concurrent_ordered_map.h"
+#include "s21_containers/s21_flat_map.h"
+#include "s21_containers/s21_flat_set.h"
+#include "s21_containers/s21_persistent_map.h"
+#include "s21_containers/s21_static_map.h"
+#include "s21_containers/s21_static_set.h"
+#include "s21_containers/s21_unordered_map.h"
+#include "s21_containers/s21_unordered_set.h"
 
 #endif  // CPP2_S21_CONTAINERS_1_S21_CONTAINERSPLUS_H
@@ -0,0 +1,160 @@
+#include "../s21_containers/s21_btree_map.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+// Counts the blocks still allocated from it, to tell which resource a
+// container returns its memory to.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  long live = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    ++live;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+
+  void do_deallocate(void *block, std::size_t bytes,
+                     std::size_t align) override {
+    --live;
+    std::pmr::new_delete_resource()->deallocate(block, bytes, align);
+  }
+
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+TEST(BTreeMap, MatchesStdUnderChurn) {
+  s21::btree_map<int, std::string> s21_map;
+  std::map<int, std::string> std_map;
+  std::mt19937 rng(12);
+
+  for (int i = 0; i < 40000; ++i) {
+    int key = static_cast<int>(rng() % 8000);
+    if (rng() % 3) {
+      s21_map.insert_or_assign(key, std::to_string(i));
+      std_map.insert_or_assign(key, std::to_string(i));
+    } else {
+      auto it = s21_map.find(key);
+      ASSERT_EQ(it != s21_map.end(), std_map.erase(key) == 1);
+      if (it != s21_map.end()) s21_map.erase(it);
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (const auto &item : s21_map) {
+    EXPECT_EQ(item.first, std_it->first);
+    EXPECT_EQ(item.second, std_it->second);
+    ++std_it;
+  }
+}
+
+TEST(BTreeMap, Accessors) {
+  s21::btree_map<int, std::string> s21_map = {{2, "two"}, {1, "one"}};
+
+  EXPECT_EQ(s21_map.at(1), "one");
+  EXPECT_THROW(s21_map.at(3), std::out_of_range);
+  s21_map[3] = "three";
+  EXPECT_EQ(s21_map[3], "three");
+  EXPECT_EQ(s21_map[4], "");
+
+  EXPECT_FALSE(s21_map.insert(1, "uno").second);
+  EXPECT_FALSE(s21_map.try_emplace(2, "dos").second);
+  EXPECT_TRUE(s21_map.try_emplace(5, 3, 'x').second);
+  EXPECT_EQ(s21_map.at(5), "xxx");
+  EXPECT_TRUE(s21_map.emplace(6, "six").second);
+  EXPECT_EQ(s21_map.size(), 6);
+}
+
+TEST(BTreeMap, LatestFirst) {
+  s21::btree_map<int, int> s21_map;
+  for (int stamp = 0; stamp < 5000; ++stamp)
+    s21_map.insert(stamp * 7 % 5000, stamp);
+
+  int expected = 4999;
+  for (auto it = s21_map.rbegin(); it != s21_map.rend(); ++it, --expected)
+    ASSERT_EQ(it->first, expected);
+  EXPECT_EQ(expected, -1);
+}
+
+TEST(BTreeMap, CopyAndSortedConstructor) {
+  std::vector<std::pair<const int, int>> items;
+  for (int i = 0; i < 3000; ++i) items.emplace_back(i, i * i);
+
+  s21::btree_map<int, int> s21_map(s21::sorted_unique, items.begin(),
+                                   items.end());
+  s21::btree_map<int, int> copy(s21_map);
+  EXPECT_EQ(copy.size(), 3000);
+  EXPECT_EQ(copy.at(1500), 1500 * 1500);
+  EXPECT_EQ(std::distance(copy.lower_bound(1000), copy.upper_bound(1999)),
+            1000);
+}
+
+TEST(BTreeMap, CopyAssignmentKeepsResource) {
+  CountingResource source_arena;
+  CountingResource target_arena;
+  {
+    s21::pmr::btree_map<int, std::string> source(&source_arena);
+    for (int i = 0; i < 1000; ++i) source.insert(i, std::to_string(i));
+    long blocks = source_arena.live;
+
+    s21::pmr::btree_map<int, std::string> target(&target_arena);
+    target.insert(-1, "gone");
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &target_arena);
+    EXPECT_EQ(target.size(), 1000);
+    EXPECT_FALSE(target.contains(-1));
+    EXPECT_EQ(target.at(500), "500");
+    EXPECT_EQ(source_arena.live, blocks);
+
+    target = target;
+    EXPECT_EQ(target.size(), 1000);
+  }
+  EXPECT_EQ(source_arena.live, 0);
+  EXPECT_EQ(target_arena.live, 0);
+}
+
+TEST(BTreeMap, MoveKeepsResource) {
+  CountingResource arena;
+  CountingResource fallback;
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(&fallback);
+  {
+    s21::pmr::btree_map<int, std::string> s21_map(&arena);
+    for (int i = 0; i < 1000; ++i) s21_map.insert(i, std::string(40, 'x'));
+    long blocks = arena.live;
+
+    s21::pmr::btree_map<int, std::string> moved(std::move(s21_map));
+    EXPECT_EQ(moved.get_allocator().resource(), &arena);
+    EXPECT_EQ(moved.at(999), std::string(40, 'x'));
+    EXPECT_EQ(arena.live, blocks);
+
+    s21::pmr::btree_map<int, std::string> other;
+    other.insert(1, "one");
+    other = std::move(moved);
+    EXPECT_EQ(other.get_allocator().resource(), &fallback);
+    EXPECT_EQ(other.size(), 1000);
+    EXPECT_EQ(other.begin()->first, 0);
+    EXPECT_EQ(std::prev(other.end())->first, 999);
+    EXPECT_TRUE(moved.empty());
+
+    s21::pmr::btree_map<int, std::string> same(&arena);
+    same = std::move(other);
+    EXPECT_EQ(same.size(), 1000);
+    EXPECT_TRUE(other.empty());
+  }
+  std::pmr::set_default_resource(previous);
+  EXPECT_EQ(arena.live, 0);
+  EXPECT_EQ(fallback.live, 0);
+}
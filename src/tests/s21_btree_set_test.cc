@@ -0,0 +1,151 @@
+#include "../s21_containers/s21_btree_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(BTreeSet, MatchesStdUnderChurn) {
+  s21::btree_set<int> s21_set;
+  std::set<int> std_set;
+  std::mt19937 rng(21);
+
+  // Enough keys for three levels, and erases that drain nodes until they
+  // borrow from their siblings and merge.
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 20000; ++i) {
+      int key = static_cast<int>(rng() % 30000);
+      EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+    }
+    for (int i = 0; i < 25000; ++i) {
+      int key = static_cast<int>(rng() % 30000);
+      auto it = s21_set.find(key);
+      ASSERT_EQ(it != s21_set.end(), std_set.erase(key) == 1);
+      if (it != s21_set.end()) s21_set.erase(it);
+    }
+    ASSERT_EQ(s21_set.size(), std_set.size());
+    EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                           std_set.end()));
+    EXPECT_TRUE(std::equal(s21_set.rbegin(), s21_set.rend(), std_set.rbegin(),
+                           std_set.rend()));
+  }
+
+  while (!s21_set.empty()) s21_set.erase(s21_set.begin());
+  EXPECT_TRUE(s21_set.begin() == s21_set.end());
+}
+
+TEST(BTreeSet, Bounds) {
+  s21::btree_set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 5000; ++i) {
+    s21_set.insert(i * 3);
+    std_set.insert(i * 3);
+  }
+
+  for (int key = -2; key < 15005; key += 7) {
+    auto lower = s21_set.lower_bound(key);
+    auto std_lower = std_set.lower_bound(key);
+    ASSERT_EQ(lower == s21_set.end(), std_lower == std_set.end());
+    if (lower != s21_set.end()) {
+      EXPECT_EQ(*lower, *std_lower);
+    }
+
+    auto upper = s21_set.upper_bound(key);
+    auto std_upper = std_set.upper_bound(key);
+    ASSERT_EQ(upper == s21_set.end(), std_upper == std_set.end());
+    if (upper != s21_set.end()) {
+      EXPECT_EQ(*upper, *std_upper);
+    }
+
+    auto range = s21_set.equal_range(key);
+    bool present = key % 3 == 0 && key >= 0 && key < 15000;
+    EXPECT_EQ(std::distance(range.first, range.second), present ? 1 : 0);
+  }
+}
+
+TEST(BTreeSet, StringKeys) {
+  s21::btree_set<std::string, std::less<>> s21_set;
+  std::set<std::string> std_set;
+  for (int i = 0; i < 3000; ++i) {
+    std::string key = "key-" + std::to_string(i * 7919 % 3001);
+    s21_set.emplace(key);
+    std_set.insert(key);
+  }
+  for (int i = 0; i < 3000; i += 3) {
+    std::string key = "key-" + std::to_string(i);
+    if (std_set.erase(key)) s21_set.erase(s21_set.find(key));
+  }
+
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                         std_set.end()));
+  EXPECT_TRUE(s21_set.contains(std::string_view("key-1")));
+  EXPECT_FALSE(s21_set.contains(std::string_view("key-3")));
+}
+
+TEST(BTreeSet, CopyMoveAndMerge) {
+  s21::btree_set<int> s21_set;
+  for (int i = 0; i < 1000; ++i) s21_set.insert(i * 2);
+
+  s21::btree_set<int> copy(s21_set);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), s21_set.begin(),
+                         s21_set.end()));
+
+  s21::btree_set<int> assigned;
+  assigned.insert(-1);
+  assigned = s21_set;
+  EXPECT_TRUE(std::equal(assigned.begin(), assigned.end(), s21_set.begin(),
+                         s21_set.end()));
+
+  s21::btree_set<int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 1000);
+  EXPECT_TRUE(copy.empty());
+
+  s21::btree_set<int> other;
+  for (int i = 0; i < 1000; ++i) other.insert(i * 3);
+  moved.merge(other);
+
+  std::set<int> expected;
+  for (int i = 0; i < 1000; ++i) expected.insert({i * 2, i * 3});
+  EXPECT_TRUE(std::equal(moved.begin(), moved.end(), expected.begin(),
+                         expected.end()));
+  // The multiples of six were already there and stay behind.
+  EXPECT_EQ(other.size(), 334);
+  for (int key : other) EXPECT_EQ(key % 6, 0);
+}
+
+TEST(BTreeSet, AssignSorted) {
+  std::vector<int> sorted = {1, 2, 2, 3, 5, 8, 8, 13};
+  s21::btree_set<int> s21_set(s21::sorted_unique, sorted.begin(), sorted.end());
+  EXPECT_EQ(s21_set.size(), 6);
+
+  std::vector<int> unsorted = {1, 3, 2};
+  EXPECT_THROW(s21_set.assign_sorted(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+  EXPECT_EQ(s21_set.size(), 6);
+}
+
+TEST(BTreeSet, InsertWithHintAtEnd) {
+  s21::btree_set<int> s21_set;
+  for (int i = 0; i < 10000; ++i) s21_set.insert(s21_set.end(), i);
+  s21_set.insert(s21_set.end(), 5);
+  s21_set.emplace_hint(s21_set.end(), -1);
+
+  EXPECT_EQ(s21_set.size(), 10001);
+  EXPECT_EQ(*s21_set.begin(), -1);
+  EXPECT_EQ(*--s21_set.end(), 9999);
+}
+
+TEST(BTreeSet, MonotonicBuffer) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::btree_set<int> s21_set(&resource);
+  for (int i = 0; i < 2000; ++i) s21_set.insert(i * 17 % 2000);
+
+  EXPECT_EQ(s21_set.size(), 2000);
+  EXPECT_EQ(s21_set.get_allocator().resource(), &resource);
+}
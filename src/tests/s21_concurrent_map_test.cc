@@ -0,0 +1,100 @@
+#include "../s21_containers/s21_concurrent_map.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr int kThreads = 8;
+
+template <typename F>
+void RunThreads(F &&work) {
+  std::vector<std::thread> threads;
+  for (int id = 0; id < kThreads; ++id) threads.emplace_back(work, id);
+  for (std::thread &thread : threads) thread.join();
+}
+}  // namespace
+
+TEST(ConcurrentMap, SingleThread) {
+  s21::concurrent_map<int, std::string> map(5);
+  EXPECT_EQ(map.shard_count(), 8);
+  EXPECT_TRUE(map.empty());
+
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_FALSE(map.insert({1, "uno"}));
+  EXPECT_EQ(map.find(1), "one");
+  EXPECT_FALSE(map.find(2).has_value());
+
+  EXPECT_FALSE(map.insert_or_assign(1, "ein"));
+  EXPECT_TRUE(map.insert_or_assign(2, "zwei"));
+  EXPECT_TRUE(map.update(2, [](std::string &value) { value += "!"; }));
+  EXPECT_FALSE(map.update(3, [](std::string &value) { value += "!"; }));
+  EXPECT_EQ(map.find(2), "zwei!");
+
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 1);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ConcurrentMap, DisjointWriters) {
+  s21::concurrent_map<int, int> map;
+  RunThreads([&](int id) {
+    for (int i = 0; i < 5000; ++i) map.insert(id * 5000 + i, id);
+    for (int i = 0; i < 5000; i += 2) map.erase(id * 5000 + i);
+  });
+
+  EXPECT_EQ(map.size(), kThreads * 2500);
+  for (int key = 0; key < kThreads * 5000; ++key)
+    ASSERT_EQ(map.contains(key), key % 2 == 1);
+  std::size_t visited = 0;
+  map.for_each([&](const std::pair<const int, int> &item) {
+    EXPECT_EQ(item.second, item.first / 5000);
+    ++visited;
+  });
+  EXPECT_EQ(visited, kThreads * 2500);
+}
+
+TEST(ConcurrentMap, UpdateIsAtomic) {
+  s21::concurrent_map<int, long> map;
+  for (int key = 0; key < 16; ++key) map.insert(key, 0);
+
+  RunThreads([&](int) {
+    for (int i = 0; i < 4000; ++i)
+      map.update(i % 16, [](long &value) { ++value; });
+  });
+
+  for (int key = 0; key < 16; ++key) EXPECT_EQ(map.find(key), kThreads * 250);
+}
+
+// Every value the writer stores ends in its key, so a reader that saw a
+// half-written shard would find one that does not.
+TEST(ConcurrentMap, ReadersDuringWrites) {
+  s21::concurrent_map<int, int> map(4);
+  std::atomic<bool> done{false};
+
+  std::thread writer([&] {
+    for (int i = 0; i < 20000; ++i) {
+      map.insert_or_assign(i % 1000, i);
+      if (i % 3 == 0) map.erase((i + 500) % 1000);
+    }
+    done = true;
+  });
+
+  std::size_t scans = 0;
+  while (!done || scans == 0) {
+    std::size_t count = 0;
+    map.for_each([&](const std::pair<const int, int> &item) {
+      EXPECT_EQ(item.second % 1000, item.first);
+      ++count;
+    });
+    EXPECT_LE(count, 1000);
+    ++scans;
+  }
+  writer.join();
+}
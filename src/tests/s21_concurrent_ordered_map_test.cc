@@ -0,0 +1,177 @@
+#include "../s21_containers/s21_concurrent_ordered_map.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr int kThreads = 8;
+
+template <typename F>
+void RunThreads(F &&work) {
+  std::vector<std::thread> threads;
+  for (int id = 0; id < kThreads; ++id) threads.emplace_back(work, id);
+  for (std::thread &thread : threads) thread.join();
+}
+}  // namespace
+
+TEST(ConcurrentOrderedMap, MatchesStdSingleThreaded) {
+  s21::concurrent_ordered_map<int, std::string> s21_map;
+  std::map<int, std::string> std_map;
+  std::mt19937 rng(17);
+
+  for (int i = 0; i < 30000; ++i) {
+    int key = static_cast<int>(rng() % 3000);
+    if (rng() % 3) {
+      std::string value = std::to_string(i);
+      EXPECT_EQ(s21_map.insert(key, value).second,
+                std_map.insert({key, value}).second);
+    } else {
+      ASSERT_EQ(s21_map.erase(key), std_map.erase(key));
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (const auto &item : s21_map) {
+    ASSERT_EQ(item.first, std_it->first);
+    EXPECT_EQ(item.second, std_it->second);
+    ++std_it;
+  }
+  EXPECT_TRUE(std_it == std_map.end());
+}
+
+TEST(ConcurrentOrderedMap, Accessors) {
+  s21::concurrent_ordered_map<int, std::string> s21_map = {{2, "two"},
+                                                           {1, "one"}};
+  EXPECT_EQ(s21_map.at(1), "one");
+  EXPECT_THROW(s21_map.at(3), std::out_of_range);
+  EXPECT_TRUE(s21_map.contains(2));
+  EXPECT_FALSE(s21_map.contains(3));
+
+  EXPECT_FALSE(s21_map.insert(1, "uno").second);
+  EXPECT_FALSE(s21_map.try_emplace(2, "dos").second);
+  EXPECT_TRUE(s21_map.try_emplace(5, 3, 'x').second);
+  EXPECT_EQ(s21_map.at(5), "xxx");
+  EXPECT_TRUE(s21_map.emplace(6, "six").second);
+  EXPECT_FALSE(s21_map.emplace(6, "sechs").second);
+
+  auto results = s21_map.insert_many(std::make_pair(7, "seven"),
+                                     std::make_pair(1, "ein"));
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_EQ(s21_map.size(), 5);
+
+  s21_map.erase(s21_map.find(5));
+  EXPECT_TRUE(s21_map.find(5) == s21_map.end());
+  s21_map.clear();
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_TRUE(s21_map.begin() == s21_map.end());
+}
+
+TEST(ConcurrentOrderedMap, ManyLiveIterators) {
+  using map_type = s21::concurrent_ordered_map<int, int>;
+  map_type s21_map;
+  for (int i = 0; i < 1000; ++i) s21_map.insert(i, i);
+
+  // Each iterator pins a slot of its own, far more of them than fit in the
+  // first block of slots.
+  std::vector<map_type::iterator> held;
+  for (int i = 0; i < 1000; ++i) held.push_back(s21_map.find(i));
+  for (int i = 0; i < 1000; i += 2) s21_map.erase(i);
+  std::vector<map_type::iterator> copies(held);
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(held[i]->second, i);
+    ASSERT_EQ(copies[i]->first, i);
+  }
+  held.clear();
+  copies.clear();
+  for (int i = 1000; i < 2000; ++i) s21_map.insert(i, i);
+  EXPECT_EQ(s21_map.size(), 1500);
+}
+
+TEST(ConcurrentOrderedMap, RangeScan) {
+  s21::concurrent_ordered_map<int, int> s21_map;
+  for (int i = 0; i < 1000; ++i) s21_map.insert(i * 10, i);
+
+  std::vector<int> keys;
+  for (auto it = s21_map.lower_bound(4995); it != s21_map.end(); ++it) {
+    if (it->first >= 5100) break;
+    keys.push_back(it->first);
+  }
+  EXPECT_EQ(keys, (std::vector<int>{5000, 5010, 5020, 5030, 5040, 5050, 5060,
+                                    5070, 5080, 5090}));
+  EXPECT_EQ(s21_map.upper_bound(5000)->first, 5010);
+  EXPECT_EQ(s21_map.lower_bound(5000)->first, 5000);
+  EXPECT_TRUE(s21_map.lower_bound(9991) == s21_map.end());
+}
+
+TEST(ConcurrentOrderedMap, ConcurrentWriters) {
+  s21::concurrent_ordered_map<int, int> s21_map;
+
+  // Every thread inserts all keys and erases the ones of its residue, so
+  // inserts and erases of the same keys race all the time.
+  RunThreads([&](int id) {
+    std::mt19937 rng(id);
+    for (int i = 0; i < 20000; ++i) {
+      int key = static_cast<int>(rng() % 4000);
+      if (key % kThreads == id)
+        s21_map.erase(key);
+      else
+        s21_map.insert(key, key);
+    }
+  });
+
+  // Single-threaded again: the map must be a proper sorted set of keys.
+  std::size_t count = 0;
+  int previous = -1;
+  for (const auto &item : s21_map) {
+    EXPECT_LT(previous, item.first);
+    EXPECT_EQ(item.first, item.second);
+    previous = item.first;
+    ++count;
+  }
+  EXPECT_EQ(count, s21_map.size());
+}
+
+TEST(ConcurrentOrderedMap, ScansDuringWrites) {
+  s21::concurrent_ordered_map<int, int> s21_map;
+  // The even keys stay for the whole test; the odd ones come and go.
+  for (int key = 0; key < 2000; key += 2) s21_map.insert(key, key);
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> writers;
+  for (int id = 0; id < 4; ++id) {
+    writers.emplace_back([&, id] {
+      std::mt19937 rng(id);
+      for (int i = 0; i < 30000; ++i) {
+        int key = static_cast<int>(rng() % 1000) * 2 + 1;
+        if (rng() % 2)
+          s21_map.insert(key, key);
+        else
+          s21_map.erase(key);
+      }
+    });
+  }
+  std::thread scanner([&] {
+    while (!done) {
+      int previous = -1, evens = 0;
+      for (auto it = s21_map.lower_bound(0); it != s21_map.end(); ++it) {
+        ASSERT_LT(previous, it->first);
+        evens += it->first % 2 == 0;
+        previous = it->first;
+      }
+      ASSERT_EQ(evens, 1000);
+    }
+  });
+
+  for (std::thread &writer : writers) writer.join();
+  done = true;
+  scanner.join();
+}
@@ -0,0 +1,118 @@
+#include "../s21_containers/s21_flat_map.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST(FlatMap, BuildsSortedKeepingFirst) {
+  std::vector<std::pair<int, std::string>> items;
+  for (int i = 0; i < 500; ++i)
+    items.emplace_back(i * 31 % 200, std::to_string(i));
+
+  s21::flat_map<int, std::string> s21_map(items.begin(), items.end());
+  std::map<int, std::string> std_map(items.begin(), items.end());
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it, ++std_it) {
+    EXPECT_EQ(it->first, std_it->first);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+  for (int i = 0; i < 200; ++i) EXPECT_EQ(s21_map.keys()[i], i);
+}
+
+TEST(FlatMap, Accessors) {
+  s21::flat_map<int, std::string> s21_map = {{2, "two"}, {1, "one"}};
+
+  EXPECT_EQ(s21_map.at(1), "one");
+  EXPECT_THROW(s21_map.at(3), std::out_of_range);
+  s21_map[3] = "three";
+  EXPECT_EQ(s21_map[3], "three");
+  EXPECT_EQ(s21_map[0], "");
+
+  EXPECT_FALSE(s21_map.insert(1, "uno").second);
+  EXPECT_EQ(s21_map.at(1), "one");
+  EXPECT_FALSE(s21_map.insert_or_assign(1, "uno").second);
+  EXPECT_EQ(s21_map.at(1), "uno");
+  EXPECT_TRUE(s21_map.try_emplace(5, 3, 'x').second);
+  EXPECT_EQ(s21_map.at(5), "xxx");
+  EXPECT_TRUE(s21_map.emplace(4, "four").second);
+  EXPECT_TRUE(s21_map.contains(4));
+  EXPECT_EQ(s21_map.size(), 6);
+}
+
+TEST(FlatMap, MatchesStd) {
+  s21::flat_map<int, int> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 2000; ++i) {
+    int key = i * 7919 % 601;
+    s21_map.insert_or_assign(key, i);
+    std_map.insert_or_assign(key, i);
+    if (i % 3 == 0) {
+      auto it = s21_map.find(key / 2);
+      ASSERT_EQ(it != s21_map.end(), std_map.erase(key / 2) == 1);
+      if (it != s21_map.end()) s21_map.erase(it);
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.rbegin();
+  for (auto it = s21_map.rbegin(); it != s21_map.rend(); ++it, ++std_it) {
+    EXPECT_EQ((*it).first, std_it->first);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+  EXPECT_EQ(s21_map.lower_bound(300)->first, std_map.lower_bound(300)->first);
+  EXPECT_EQ(std::distance(s21_map.begin(), s21_map.upper_bound(100)),
+            std::distance(std_map.begin(), std_map.upper_bound(100)));
+}
+
+TEST(FlatMap, RangeInsertMerges) {
+  s21::flat_map<int, int> s21_map = {{1, 10}, {3, 30}, {5, 50}};
+  std::vector<std::pair<int, int>> more = {{4, 40}, {3, 0}, {0, 0}, {4, 1}};
+  s21_map.insert(more.begin(), more.end());
+
+  std::vector<std::pair<int, int>> expected = {
+      {0, 0}, {1, 10}, {3, 30}, {4, 40}, {5, 50}};
+  ASSERT_EQ(s21_map.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_map.keys()[i], expected[i].first);
+    EXPECT_EQ(s21_map.values()[i], expected[i].second);
+  }
+}
+
+TEST(FlatMap, CopyAssignment) {
+  s21::flat_map<int, std::string> s21_map = {{1, "one"}, {2, "two"}};
+  s21::flat_map<int, std::string> copy = {{7, "seven"}};
+  copy = s21_map;
+  s21_map[3] = "three";
+
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.at(2), "two");
+  EXPECT_FALSE(copy.contains(7));
+  EXPECT_FALSE(copy.contains(3));
+}
+
+TEST(FlatMap, MoveAssignAcrossResources) {
+  static_assert(
+      std::is_nothrow_move_assignable<s21::flat_map<int, int>>::value);
+  static_assert(
+      !std::is_nothrow_move_assignable<s21::pmr::flat_map<int, int>>::value);
+
+  s21::pmr::flat_map<int, int> source(std::pmr::new_delete_resource());
+  for (int i = 0; i < 10; ++i) source.insert(i, i * i);
+
+  s21::pmr::flat_map<int, int> target(std::pmr::null_memory_resource());
+  EXPECT_THROW(target = std::move(source), std::bad_alloc);
+  EXPECT_TRUE(target.empty());
+
+  s21::pmr::flat_map<int, int> other(std::pmr::new_delete_resource());
+  other = std::move(source);
+  EXPECT_EQ(other.get_allocator().resource(),
+            std::pmr::new_delete_resource());
+}
@@ -0,0 +1,105 @@
+#include "../s21_containers/s21_flat_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+TEST(FlatSet, BuildsSortedAndUnique) {
+  std::vector<int> keys;
+  for (int i = 0; i < 2000; ++i) keys.push_back(i * 7919 % 1000);
+
+  s21::flat_set<int> s21_set(keys.begin(), keys.end());
+  std::set<int> std_set(keys.begin(), keys.end());
+  EXPECT_EQ(s21_set.size(), 1000);
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                         std_set.end()));
+  EXPECT_TRUE(std::equal(s21_set.rbegin(), s21_set.rend(), std_set.rbegin(),
+                         std_set.rend()));
+}
+
+TEST(FlatSet, InsertAndErase) {
+  s21::flat_set<int> s21_set = {5, 1, 3};
+  std::set<int> std_set = {5, 1, 3};
+
+  for (int i = 0; i < 300; ++i) {
+    int key = i * 37 % 101;
+    EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+    if (i % 4 == 0 && std_set.erase(key / 2))
+      s21_set.erase(s21_set.find(key / 2));
+  }
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                         std_set.end()));
+  EXPECT_FALSE(s21_set.emplace(*s21_set.begin()).second);
+}
+
+TEST(FlatSet, RangeInsertKeepsExisting) {
+  s21::flat_set<std::string, std::less<>> s21_set = {"b", "d"};
+  std::vector<std::string> more = {"e", "a", "d", "c", "a"};
+  s21_set.insert(more.begin(), more.end());
+
+  std::vector<std::string> expected = {"a", "b", "c", "d", "e"};
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), expected.begin(),
+                         expected.end()));
+  EXPECT_TRUE(s21_set.contains(std::string_view("c")));
+}
+
+TEST(FlatSet, Bounds) {
+  s21::flat_set<int> s21_set = {10, 20, 30};
+
+  EXPECT_EQ(*s21_set.lower_bound(20), 20);
+  EXPECT_EQ(*s21_set.upper_bound(20), 30);
+  EXPECT_TRUE(s21_set.lower_bound(31) == s21_set.end());
+  auto range = s21_set.equal_range(15);
+  EXPECT_TRUE(range.first == range.second);
+  EXPECT_TRUE(s21_set.find(25) == s21_set.end());
+}
+
+TEST(FlatSet, SortedUnique) {
+  std::vector<int> sorted = {1, 2, 4};
+  s21::flat_set<int> s21_set(s21::sorted_unique, sorted.begin(), sorted.end());
+  EXPECT_EQ(s21_set.size(), 3);
+
+  std::vector<int> repeated = {1, 1, 2};
+  EXPECT_THROW(s21::flat_set<int>(s21::sorted_unique, repeated.begin(),
+                                  repeated.end()),
+               std::invalid_argument);
+}
+
+TEST(FlatSet, CopyMoveAndAllocator) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::flat_set<int> s21_set(&resource);
+  for (int i = 0; i < 100; ++i) s21_set.insert(99 - i);
+
+  s21::pmr::flat_set<int> copy(s21_set);
+  s21::pmr::flat_set<int> moved(std::move(s21_set));
+  EXPECT_EQ(copy.size(), 100);
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ(*moved.begin(), 0);
+  EXPECT_EQ(moved.get_allocator().resource(), &resource);
+}
+
+TEST(FlatSet, Assignment) {
+  static_assert(std::is_nothrow_move_assignable<s21::flat_set<int>>::value);
+  static_assert(
+      !std::is_nothrow_move_assignable<s21::pmr::flat_set<int>>::value);
+
+  s21::flat_set<int> s21_set = {3, 1, 2};
+  s21::flat_set<int> copy = {9};
+  copy = s21_set;
+  s21_set.insert(4);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_FALSE(copy.contains(9));
+
+  s21::pmr::flat_set<int> source = {1, 2, 3};
+  s21::pmr::flat_set<int> target(std::pmr::null_memory_resource());
+  EXPECT_THROW(target = std::move(source), std::bad_alloc);
+  EXPECT_TRUE(target.empty());
+}
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory_resource>
+#include <type_traits>
 
 template <typename value_type>
 bool CompareLists(s21::list<value_type> my_list,
@@ -352,3 +354,70 @@ TEST(ListBonus, InsertMany) {
   my_list.insert_many(my_list.begin(), 4, 5, 6);
   EXPECT_TRUE(CompareLists(my_list, std_list));
 }
+
+TEST(ListAllocator, MonotonicBuffer) {
+  unsigned char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::list<int> my_list({1, 2, 3}, &arena);
+  my_list.push_front(0);
+  my_list.push_back(4);
+
+  EXPECT_EQ(my_list.size(), 5);
+  EXPECT_EQ(my_list.front(), 0);
+  EXPECT_EQ(my_list.back(), 4);
+  EXPECT_EQ(my_list.get_allocator().resource(), &arena);
+}
+
+namespace {
+// Counts its copies, to tell whether a list moved its values or copied them.
+struct CopyCounter {
+  static int copies;
+
+  CopyCounter(int value = 0) : value(value) {}
+  CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+  CopyCounter(CopyCounter &&) = default;
+  CopyCounter &operator=(const CopyCounter &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CopyCounter &operator=(CopyCounter &&) = default;
+
+  int value;
+};
+
+int CopyCounter::copies = 0;
+}  // namespace
+
+TEST(ListAllocator, MoveAssignAcrossResources) {
+  static_assert(std::is_nothrow_move_assignable<s21::list<int>>::value);
+  static_assert(!std::is_nothrow_move_assignable<s21::pmr::list<int>>::value);
+
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::list<CopyCounter> source({1, 2, 3});
+  s21::pmr::list<CopyCounter> target({9}, &arena);
+  CopyCounter::copies = 0;
+
+  target = std::move(source);
+
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(target.get_allocator().resource(), &arena);
+  EXPECT_EQ(target.size(), 3);
+  EXPECT_EQ(target.front().value, 1);
+  EXPECT_EQ(target.back().value, 3);
+  EXPECT_TRUE(source.empty());
+}
+
+TEST(ListModifiers, ReuseAfterMoveAndPop) {
+  s21::list<int> source = {1, 2};
+  s21::list<int> target = {3};
+  target = std::move(source);
+  source.push_back(4);
+  EXPECT_TRUE(CompareLists(source, std::list<int>{4}));
+
+  target.pop_front();
+  target.pop_front();
+  target.push_back(5);
+  EXPECT_TRUE(CompareLists(target, std::list<int>{5}));
+}
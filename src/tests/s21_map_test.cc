@@ -3,7 +3,13 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 TEST(MapConstructors, DefaultConstructor) {
   s21::map<int, std::string> s21_map;
@@ -51,6 +57,36 @@ TEST(MapConstructors, CopyConstructor) {
   EXPECT_EQ(copy_std.at(3), "three");
 }
 
+TEST(MapConstructors, CopyAssignmentOperator) {
+  s21::map<int, std::string> s21_map;
+  for (int i = 0; i < 1000; ++i) s21_map.insert(i, std::to_string(i));
+  s21::map<int, std::string> copy_s21 = {{-1, "minus one"}};
+
+  copy_s21 = s21_map;
+  copy_s21[5] = "five";
+
+  EXPECT_EQ(copy_s21.size(), 1000);
+  EXPECT_FALSE(copy_s21.contains(-1));
+  EXPECT_EQ(copy_s21.at(999), "999");
+  EXPECT_EQ(s21_map.at(5), "5");
+  EXPECT_EQ((*copy_s21.nth(500)).first, 500);
+}
+
+TEST(MapAllocator, CopyKeepsResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::map<int, int> s21_map(&arena);
+  for (int i = 0; i < 100; ++i) s21_map.insert(i, i);
+
+  s21::pmr::map<int, int> copy_s21(s21_map);
+  s21::pmr::map<int, int> assigned(&arena);
+  assigned = copy_s21;
+
+  EXPECT_EQ(copy_s21.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  EXPECT_EQ(assigned.get_allocator().resource(), &arena);
+  EXPECT_EQ(assigned.size(), 100);
+}
+
 TEST(MapConstructors, MoveConstructor) {
   s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}, {3, "three"}};
   s21::map<int, std::string> move_s21(std::move(s21_map));
@@ -87,6 +123,64 @@ TEST(MapConstructors, MoveAssignmentOperator) {
   EXPECT_EQ(move_std.at(3), "three");
 }
 
+TEST(MapConstructors, MoveAssignmentStealsNodes) {
+  static_assert(std::is_nothrow_move_constructible<s21::map<int, int>>::value);
+  static_assert(std::is_nothrow_move_assignable<s21::map<int, int>>::value);
+
+  s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}, {3, "three"}};
+  s21::map<int, std::string> move_s21 = {{4, "four"}};
+  auto two = s21_map.find(2);
+
+  move_s21 = std::move(s21_map);
+
+  EXPECT_EQ(move_s21.size(), 3);
+  EXPECT_FALSE(move_s21.contains(4));
+  EXPECT_TRUE(two == move_s21.find(2));
+  EXPECT_EQ((*--move_s21.end()).second, "three");
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_TRUE(s21_map.begin() == s21_map.end());
+
+  s21_map.insert(5, "five");
+  s21::map<int, std::string> &self = move_s21;
+  move_s21 = std::move(self);
+  EXPECT_EQ(s21_map.size(), 1);
+  EXPECT_EQ(move_s21.size(), 3);
+}
+
+TEST(MapConstructors, MovedIntoVector) {
+  s21::vector<s21::map<int, int>> maps;
+  s21::map<int, int> first;
+  for (int i = 0; i < 100; ++i) first.insert(i, i * i);
+  auto ten = first.find(10);
+  maps.push_back(std::move(first));
+
+  for (int i = 0; i < 100; ++i) maps.push_back(s21::map<int, int>{{i, i}});
+
+  EXPECT_TRUE(maps[0].find(10) == ten);
+  EXPECT_EQ(maps[0].size(), 100);
+  EXPECT_EQ((*--maps[0].end()).second, 99 * 99);
+  EXPECT_EQ(maps[100].at(99), 99);
+}
+
+TEST(MapAllocator, MoveAcrossResources) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::map<int, std::string> s21_map;
+  for (int i = 0; i < 100; ++i) s21_map.insert(i, std::string(40, 'x'));
+  s21::pmr::map<int, std::string> moved(&arena);
+
+  moved = std::move(s21_map);
+
+  EXPECT_EQ(moved.get_allocator().resource(), &arena);
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ((*moved.nth(50)).first, 50);
+  EXPECT_EQ(moved.at(99), std::string(40, 'x'));
+  EXPECT_TRUE(s21_map.empty());
+
+  s21::pmr::map<int, std::string> stolen(std::move(moved));
+  EXPECT_EQ(stolen.get_allocator().resource(), &arena);
+  EXPECT_EQ(stolen.size(), 100);
+}
+
 TEST(MapElementAccess, At) {
   s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}, {3, "three"}};
 
@@ -141,6 +235,21 @@ TEST(MapIterators, End) {
   }
 }
 
+TEST(MapIterators, LatestFirst) {
+  s21::map<int, std::string> s21_map;
+  for (int stamp = 0; stamp < 100; ++stamp)
+    s21_map.insert(stamp * 7 % 100, std::to_string(stamp));
+
+  // The three newest entries, read back from the end.
+  int expected = 99;
+  for (auto it = s21_map.rbegin(); it != s21_map.rend() && expected > 96;
+       ++it, --expected) {
+    EXPECT_EQ(it->first, expected);
+  }
+  EXPECT_EQ((--s21_map.end())->first, 99);
+  EXPECT_EQ(std::distance(s21_map.rbegin(), s21_map.rend()), 100);
+}
+
 TEST(MapCapacity, Empty) {
   s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}, {3, "three"}};
 
@@ -319,4 +428,315 @@ TEST(MapLookup, Contains) {
   s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}, {3, "three"}};
 
   EXPECT_TRUE(s21_map.contains(3));
-}
\ No newline at end of file
+}
+TEST(MapLookup, Find) {
+  s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}, {3, "three"}};
+
+  EXPECT_EQ((*s21_map.find(2)).second, "two");
+  EXPECT_TRUE(s21_map.find(4) == s21_map.end());
+  EXPECT_FALSE(s21_map.contains(4));
+}
+
+TEST(MapLookup, FindBatch) {
+  s21::map<std::string, int, std::less<>> s21_map;
+  std::vector<std::string_view> keys;
+  for (int i = 0; i < 40; ++i) s21_map[std::to_string(i * 3)] = i;
+  for (int i = 0; i < 40; ++i) keys.push_back(s21_map.nth(i)->first);
+  keys.push_back("missing");
+
+  std::vector<s21::map<std::string, int, std::less<>>::iterator> found;
+  s21_map.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+
+  ASSERT_EQ(found.size(), keys.size());
+  for (int i = 0; i < 40; ++i) EXPECT_TRUE(found[i] == s21_map.nth(i));
+  EXPECT_TRUE(found.back() == s21_map.end());
+}
+
+TEST(MapLookup, NthAndRank) {
+  s21::map<int, std::string> s21_map = {
+      {10, "ten"}, {20, "twenty"}, {30, "thirty"}};
+
+  EXPECT_EQ((*s21_map.nth(1)).second, "twenty");
+  EXPECT_EQ(s21_map.rank(25), 2);
+  EXPECT_EQ(s21_map.rank(5), 0);
+}
+
+TEST(MapLookup, TransparentAt) {
+  s21::map<std::string, int, std::less<>> s21_map = {{"one", 1}, {"two", 2}};
+
+  EXPECT_EQ(s21_map.at(std::string_view("two")), 2);
+  EXPECT_TRUE(s21_map.contains(std::string_view("one")));
+  EXPECT_THROW(s21_map.at(std::string_view("three")), std::out_of_range);
+}
+
+TEST(MapModifiers, ChurnAfterClear) {
+  s21::map<int, std::string> s21_map;
+  std::map<int, std::string> std_map;
+
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 200; ++i) {
+      s21_map.insert(i, std::to_string(i));
+      std_map.insert({i, std::to_string(i)});
+    }
+    for (int i = 0; i < 200; i += 2) {
+      s21_map.erase(s21_map.find(i));
+      std_map.erase(i);
+    }
+    for (int i = 0; i < 200; i += 4) {
+      s21_map.insert(i, "again");
+      std_map.insert({i, "again"});
+    }
+    EXPECT_EQ(s21_map.size(), std_map.size());
+    for (const auto &pair : std_map)
+      EXPECT_EQ(s21_map.at(pair.first), pair.second);
+    s21_map.clear();
+    std_map.clear();
+  }
+  EXPECT_TRUE(s21_map.empty());
+}
+
+TEST(MapAllocator, MonotonicBuffer) {
+  unsigned char buffer[16384];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::map<int, int> s21_map(&arena);
+
+  for (int i = 0; i < 100; ++i) s21_map.insert(i, i * i);
+
+  EXPECT_EQ(s21_map.size(), 100);
+  EXPECT_EQ(s21_map.at(9), 81);
+  EXPECT_EQ(s21_map.get_allocator().resource(), &arena);
+}
+
+TEST(MapLookup, EqualRange) {
+  s21::map<int, std::string> s21_map = {{1, "one"}, {3, "three"}};
+
+  auto hit = s21_map.equal_range(1);
+  auto miss = s21_map.equal_range(2);
+
+  EXPECT_EQ((*hit.first).second, "one");
+  EXPECT_EQ((*hit.second).second, "three");
+  EXPECT_TRUE(miss.first == miss.second);
+  EXPECT_EQ((*miss.first).second, "three");
+  EXPECT_TRUE(s21_map.upper_bound(3) == s21_map.end());
+}
+
+TEST(MapConstructors, SortedConstructor) {
+  std::vector<std::pair<int, std::string>> items = {
+      {1, "one"}, {2, "two"}, {2, "second two"}, {3, "three"}};
+  s21::map<int, std::string> s21_map(s21::sorted_unique, items.begin(),
+                                     items.end());
+  s21::map<int, std::string> copy(s21_map);
+
+  EXPECT_EQ(s21_map.size(), 3);
+  EXPECT_EQ(s21_map.at(2), "two");
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy.at(3), "three");
+}
+
+TEST(MapAlgebra, KeyWise) {
+  s21::map<int, std::string> lhs = {{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::map<int, std::string> rhs = {{2, "x"}, {3, "y"}, {4, "z"}};
+
+  auto united = s21::set_union(lhs, rhs);
+  EXPECT_EQ(united.size(), 4);
+  EXPECT_EQ(united.at(2), "b");
+  EXPECT_EQ(united.at(4), "z");
+
+  auto common = s21::set_intersection(rhs, lhs);
+  EXPECT_EQ(common.size(), 2);
+  EXPECT_EQ(common.at(3), "y");
+
+  auto only_lhs = s21::set_difference(lhs, rhs);
+  EXPECT_EQ(only_lhs.size(), 1);
+  EXPECT_EQ(only_lhs.at(1), "a");
+
+  auto either = s21::symmetric_difference(lhs, rhs);
+  EXPECT_EQ(either.size(), 2);
+  EXPECT_TRUE(either.contains(1));
+  EXPECT_TRUE(either.contains(4));
+}
+
+TEST(MapNodeHandle, Rekey) {
+  s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}};
+
+  auto node = s21_map.extract(1);
+  node.key() = 10;
+  node.mapped() = "ten";
+  s21_map.insert(std::move(node));
+
+  EXPECT_FALSE(s21_map.contains(1));
+  EXPECT_EQ(s21_map.at(10), "ten");
+  EXPECT_EQ(s21_map.rank(10), 1);
+}
+
+TEST(MapNodeHandle, MergeKeepsDuplicates) {
+  s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}};
+  s21::map<int, std::string> other = {{2, "deux"}, {3, "trois"}};
+  std::map<int, std::string> std_map = {{1, "one"}, {2, "two"}};
+  std::map<int, std::string> std_other = {{2, "deux"}, {3, "trois"}};
+
+  s21_map.merge(other);
+  std_map.merge(std_other);
+
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_EQ(s21_map.at(2), std_map.at(2));
+  EXPECT_EQ(s21_map.at(3), std_map.at(3));
+  EXPECT_EQ(other.size(), std_other.size());
+  EXPECT_EQ(other.at(2), std_other.at(2));
+
+  other.clear();
+  s21_map.erase(s21_map.find(3));
+  s21_map.insert(4, "four");
+  EXPECT_EQ(s21_map.at(4), "four");
+}
+
+TEST(MapModifiers, EmplaceHint) {
+  s21::map<int, std::string> s21_map;
+
+  auto hint = s21_map.end();
+  for (int i = 0; i < 20; ++i)
+    hint = s21_map.emplace_hint(s21_map.end(), i, std::to_string(i));
+  auto existing = s21_map.emplace_hint(hint, 5, "five");
+  s21_map.insert(s21_map.begin(), {-1, "minus one"});
+
+  EXPECT_EQ(s21_map.size(), 21);
+  EXPECT_EQ((*existing).second, "5");
+  EXPECT_EQ((*s21_map.begin()).second, "minus one");
+  EXPECT_EQ((*s21_map.nth(20)).second, "19");
+}
+
+TEST(MapElementAccess, BracketsInsertsMissing) {
+  s21::map<std::string, int> s21_map;
+  std::map<std::string, int> std_map;
+
+  for (const char *word : {"a", "b", "a", "c", "a"}) {
+    ++s21_map[word];
+    ++std_map[word];
+  }
+
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_EQ(s21_map["a"], 3);
+  EXPECT_EQ(s21_map.at("c"), 1);
+  EXPECT_EQ(s21_map[std::string("d")], 0);
+}
+
+namespace {
+// Counts the copies and moves made of it.
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  explicit Tracked(int v) : value(v) {}
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { ++moves; }
+  Tracked &operator=(const Tracked &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+
+  int value;
+};
+}  // namespace
+
+TEST(MapModifiers, EmplaceBuildsInPlace) {
+  s21::map<int, Tracked> s21_map;
+  Tracked::copies = Tracked::moves = 0;
+
+  EXPECT_TRUE(s21_map.emplace(std::piecewise_construct,
+                              std::forward_as_tuple(1),
+                              std::forward_as_tuple(10))
+                  .second);
+  EXPECT_TRUE(s21_map.try_emplace(2, 20).second);
+  EXPECT_FALSE(s21_map.try_emplace(2, 99).second);
+  EXPECT_FALSE(s21_map.emplace(1, Tracked(11)).second);
+
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 1);
+  EXPECT_EQ(s21_map.at(1).value, 10);
+  EXPECT_EQ(s21_map.at(2).value, 20);
+}
+
+TEST(MapModifiers, InsertOrAssignOneDescent) {
+  s21::map<int, Tracked> s21_map;
+  Tracked::copies = Tracked::moves = 0;
+
+  EXPECT_TRUE(s21_map.insert_or_assign(1, Tracked(1)).second);
+  EXPECT_FALSE(s21_map.insert_or_assign(1, Tracked(2)).second);
+
+  // Only the assignment copies, as Tracked has no move assignment.
+  EXPECT_EQ(Tracked::copies, 1);
+  EXPECT_EQ(s21_map.at(1).value, 2);
+}
+
+TEST(MapLayout, CompactMap) {
+  s21::map<int, std::string, std::less<int>,
+           std::allocator<std::pair<const int, std::string>>,
+           s21::compact_layout>
+      s21_map;
+  std::map<int, std::string> std_map;
+
+  for (int i = 0; i < 500; ++i) {
+    s21_map[i % 97] += "x";
+    std_map[i % 97] += "x";
+  }
+  for (int i = 0; i < 97; i += 3) {
+    s21_map.erase(s21_map.find(i));
+    std_map.erase(i);
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (const auto &[key, value] : s21_map) {
+    EXPECT_EQ(key, std_it->first);
+    EXPECT_EQ(value, std_it->second);
+    ++std_it;
+  }
+}
+
+TEST(MapLayout, ArenaMap) {
+  s21::map<int, std::string, std::less<int>,
+           std::allocator<std::pair<const int, std::string>>,
+           s21::arena_layout>
+      s21_map;
+  std::map<int, std::string> std_map;
+
+  for (int i = 0; i < 500; ++i) {
+    s21_map[i % 97] += "x";
+    std_map[i % 97] += "x";
+  }
+  for (int i = 0; i < 97; i += 3) {
+    s21_map.erase(s21_map.find(i));
+    std_map.erase(i);
+  }
+  // The value is read from the arena while the insertion may grow it.
+  for (int i = 100; i < 400; ++i) {
+    s21_map.try_emplace(i, s21_map.at(1 + i % 32 * 3));
+    std_map.try_emplace(i, std_map.at(1 + i % 32 * 3));
+  }
+
+  auto copy = s21_map;
+  ASSERT_EQ(copy.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (const auto &[key, value] : copy) {
+    EXPECT_EQ(key, std_it->first);
+    EXPECT_EQ(value, std_it->second);
+    ++std_it;
+  }
+}
+
+TEST(MapStats, CountsLookups) {
+  s21::map<int, int, std::less<int>, std::allocator<std::pair<const int, int>>,
+           s21::arena_layout, s21::counting_stats>
+      s21_map;
+  for (int i = 0; i < 100; ++i) s21_map[i] = i;
+  s21::tree_stats before = s21_map.stats();
+
+  EXPECT_TRUE(s21_map.contains(50));
+  s21::tree_stats after = s21_map.stats();
+  EXPECT_GT(after.comparisons, before.comparisons);
+  EXPECT_LE(after.comparisons - before.comparisons, 2 * s21_map.height());
+  EXPECT_EQ(after.allocations, 100);
+  EXPECT_GT(after.insert_fixups, 0);
+}
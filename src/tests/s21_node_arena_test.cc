@@ -0,0 +1,94 @@
+#include "../binary_tree/s21_node_arena.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <set>
+
+struct ArenaTestNode {
+  int left;
+  int right;
+  long value;
+};
+
+namespace {
+// Moves every slot as raw bytes, as a tree of trivially copyable nodes does.
+void CopySlots(void *from, void *to, std::size_t used) {
+  std::memcpy(to, from, used * sizeof(ArenaTestNode));
+}
+}  // namespace
+
+TEST(NodeArena, AllocatesContiguousSlots) {
+  s21::NodeArena<ArenaTestNode> arena;
+  arena.reserve(100, CopySlots);
+  EXPECT_GE(arena.available(), 100);
+
+  for (std::size_t i = 0; i < 100; ++i)
+    EXPECT_EQ(arena.index_of(arena.allocate()), i);
+}
+
+TEST(NodeArena, ReusesFreedSlots) {
+  s21::NodeArena<ArenaTestNode> arena;
+  arena.reserve(2, CopySlots);
+  void *first = arena.allocate();
+  void *second = arena.allocate();
+  std::size_t available = arena.available();
+
+  arena.deallocate(first);
+  arena.deallocate(second);
+
+  EXPECT_EQ(arena.available(), available + 2);
+  EXPECT_EQ(arena.allocate(), second);
+  EXPECT_EQ(arena.allocate(), first);
+}
+
+TEST(NodeArena, GrowthKeepsIndicesAndFreeSlots) {
+  s21::NodeArena<ArenaTestNode> arena;
+  arena.reserve(16, CopySlots);
+  for (int i = 0; i < 16; ++i)
+    static_cast<ArenaTestNode *>(arena.allocate())->value = i;
+  arena.deallocate(arena.slot(3));
+  arena.deallocate(arena.slot(9));
+
+  arena.reserve(100, CopySlots);
+
+  EXPECT_GE(arena.available(), 100);
+  EXPECT_EQ(static_cast<ArenaTestNode *>(arena.slot(15))->value, 15);
+  EXPECT_EQ(arena.index_of(arena.allocate()), 9);
+  EXPECT_EQ(arena.index_of(arena.allocate()), 3);
+  EXPECT_EQ(arena.index_of(arena.allocate()), 16);
+}
+
+TEST(NodeArena, FailedGrowthLeavesArena) {
+  s21::NodeArena<ArenaTestNode> arena;
+  arena.reserve(1, CopySlots);
+  void *data = arena.data();
+  for (std::size_t i = arena.available(); i > 0; --i) arena.allocate();
+
+  EXPECT_THROW(arena.reserve(1, [](void *, void *, std::size_t) { throw 1; }),
+               int);
+  EXPECT_EQ(arena.data(), data);
+  EXPECT_EQ(arena.available(), 0);
+}
+
+TEST(NodeArena, CopyReleaseAndSwap) {
+  s21::NodeArena<ArenaTestNode> arena;
+  arena.reserve(10, CopySlots);
+  for (int i = 0; i < 10; ++i)
+    static_cast<ArenaTestNode *>(arena.allocate())->value = i;
+  arena.deallocate(arena.slot(4));
+
+  s21::NodeArena<ArenaTestNode> copy;
+  copy.copy(arena);
+  EXPECT_NE(copy.data(), arena.data());
+  EXPECT_EQ(static_cast<ArenaTestNode *>(copy.slot(7))->value, 7);
+  EXPECT_EQ(copy.index_of(copy.allocate()), 4);
+
+  s21::NodeArena<ArenaTestNode> other;
+  arena.swap(other);
+  EXPECT_EQ(arena.data(), nullptr);
+  arena.release();
+  other.release();
+  EXPECT_EQ(other.data(), nullptr);
+  EXPECT_EQ(other.available(), 0);
+}
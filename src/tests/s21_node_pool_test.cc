@@ -0,0 +1,166 @@
+#include "../binary_tree/s21_node_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+struct PoolTestNode {
+  PoolTestNode *left;
+  PoolTestNode *right;
+  long value;
+};
+
+namespace {
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  long allocations = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+
+  void do_deallocate(void *block, std::size_t bytes,
+                     std::size_t align) override {
+    std::pmr::new_delete_resource()->deallocate(block, bytes, align);
+  }
+
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+using PmrPool =
+    s21::NodePool<PoolTestNode, std::pmr::polymorphic_allocator<PoolTestNode>>;
+}  // namespace
+
+TEST(NodePool, AllocatesDistinctSlots) {
+  s21::NodePool<PoolTestNode> pool;
+  std::set<void *> slots;
+
+  for (int i = 0; i < 1000; ++i) slots.insert(pool.allocate());
+
+  EXPECT_EQ(slots.size(), 1000);
+}
+
+TEST(NodePool, ReusesFreedSlots) {
+  s21::NodePool<PoolTestNode> pool;
+  void *first = pool.allocate();
+  void *second = pool.allocate();
+
+  pool.deallocate(first);
+  pool.deallocate(second);
+
+  EXPECT_EQ(pool.allocate(), second);
+  EXPECT_EQ(pool.allocate(), first);
+}
+
+TEST(NodePool, ReleaseAndSwap) {
+  s21::NodePool<PoolTestNode> pool;
+  s21::NodePool<PoolTestNode> other;
+  for (int i = 0; i < 100; ++i) pool.allocate();
+
+  pool.swap(other);
+  pool.release();
+  other.release();
+  void *slot = pool.allocate();
+
+  EXPECT_NE(slot, nullptr);
+}
+
+TEST(NodePool, Absorb) {
+  s21::NodePool<PoolTestNode> pool;
+  s21::NodePool<PoolTestNode> other;
+  void *kept = pool.allocate();
+  for (int i = 0; i < 20; ++i) other.allocate();
+  void *freed = other.allocate();
+  other.deallocate(freed);
+
+  pool.absorb(other);
+  pool.deallocate(kept);
+
+  EXPECT_EQ(pool.allocate(), kept);
+  std::set<void *> slots;
+  for (int i = 0; i < 12; ++i) slots.insert(pool.allocate());
+  EXPECT_EQ(slots.count(freed), 1);
+  EXPECT_EQ(other.allocate() != nullptr, true);
+}
+
+TEST(NodePool, DetachedNodeOutlivesPool) {
+  s21::NodePool<PoolTestNode>::allocator_type alloc;
+  PoolTestNode *node;
+  void *ticket;
+  {
+    s21::NodePool<PoolTestNode> pool;
+    for (int i = 0; i < 40; ++i) pool.allocate();
+    node = static_cast<PoolTestNode *>(pool.allocate());
+    node->value = 42;
+    ticket = pool.detach(node);
+    alloc = pool.get_allocator();
+  }
+
+  EXPECT_EQ(node->value, 42);
+  s21::NodePool<PoolTestNode>::release_detached(alloc, ticket);
+}
+
+TEST(NodePool, AttachBorrowsSlab) {
+  s21::NodePool<PoolTestNode> pool;
+  PoolTestNode *node;
+  {
+    s21::NodePool<PoolTestNode> other;
+    node = static_cast<PoolTestNode *>(other.allocate());
+    node->value = 7;
+    pool.attach(other.detach(node));
+  }
+  EXPECT_EQ(node->value, 7);
+
+  void *own = pool.allocate();
+  pool.attach(pool.detach(own));
+  pool.deallocate(node);
+  EXPECT_EQ(pool.allocate(), node);
+  pool.attach(pool.detach(node));
+}
+
+TEST(NodePool, DetachFromLargeSlab) {
+  s21::NodePool<PoolTestNode>::allocator_type alloc;
+  std::vector<PoolTestNode *> nodes;
+  std::vector<void *> tickets;
+  {
+    s21::NodePool<PoolTestNode> pool;
+    pool.reserve(5000);
+    for (long i = 0; i < 5000; ++i) {
+      nodes.push_back(static_cast<PoolTestNode *>(pool.allocate()));
+      nodes.back()->value = i;
+    }
+    for (long i = 0; i < 5000; i += 997)
+      tickets.push_back(pool.detach(nodes[i]));
+    alloc = pool.get_allocator();
+  }
+
+  for (std::size_t i = 0; i < tickets.size(); ++i) {
+    EXPECT_EQ(nodes[i * 997]->value, static_cast<long>(i * 997));
+    s21::NodePool<PoolTestNode>::release_detached(alloc, tickets[i]);
+  }
+}
+
+TEST(NodePool, MovingNodesBackAndForthAllocatesNothing) {
+  CountingResource resource;
+  PmrPool source(&resource);
+  PmrPool left(&resource);
+  PmrPool right(&resource);
+  std::vector<void *> nodes;
+  for (int i = 0; i < 100; ++i) nodes.push_back(source.allocate());
+  for (void *node : nodes) left.attach(source.detach(node));
+  for (void *node : nodes) right.attach(left.detach(node));
+  long allocations = resource.allocations;
+
+  for (int round = 0; round < 1000; ++round) {
+    PmrPool &from = round % 2 ? left : right;
+    PmrPool &to = round % 2 ? right : left;
+    for (void *node : nodes) to.attach(from.detach(node));
+  }
+  EXPECT_EQ(resource.allocations, allocations);
+}
@@ -0,0 +1,111 @@
+#include "../s21_containers/s21_persistent_map.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+template <typename Map, typename StdMap>
+void ExpectSame(const Map &map, const StdMap &expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = expected.begin();
+  for (const auto &item : map) {
+    ASSERT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+}
+}  // namespace
+
+TEST(PersistentMap, MatchesStdUnderChurn) {
+  s21::persistent_map<int, int> s21_map;
+  std::map<int, int> std_map;
+  std::mt19937 rng(18);
+
+  for (int i = 0; i < 30000; ++i) {
+    int key = static_cast<int>(rng() % 3000);
+    switch (rng() % 3) {
+      case 0:
+        EXPECT_EQ(s21_map.insert(key, i), std_map.insert({key, i}).second);
+        break;
+      case 1:
+        EXPECT_EQ(s21_map.insert_or_assign(key, i),
+                  std_map.insert_or_assign(key, i).second);
+        break;
+      default:
+        EXPECT_EQ(s21_map.erase(key), std_map.erase(key));
+    }
+  }
+  ExpectSame(s21_map, std_map);
+}
+
+TEST(PersistentMap, SnapshotsKeepTheirVersion) {
+  s21::persistent_map<int, std::string> s21_map;
+  std::vector<s21::persistent_map<int, std::string>> snapshots;
+  std::vector<std::map<int, std::string>> expected;
+  std::map<int, std::string> std_map;
+
+  for (int version = 0; version < 50; ++version) {
+    for (int i = 0; i < 40; ++i) {
+      int key = (version * 37 + i * 11) % 500;
+      if (i % 4 == 3) {
+        s21_map.erase(key);
+        std_map.erase(key);
+      } else {
+        s21_map.insert_or_assign(key, std::to_string(version));
+        std_map.insert_or_assign(key, std::to_string(version));
+      }
+    }
+    snapshots.push_back(s21_map.snapshot());
+    expected.push_back(std_map);
+  }
+
+  s21_map.clear();
+  EXPECT_TRUE(s21_map.empty());
+  for (std::size_t i = 0; i < snapshots.size(); ++i)
+    ExpectSame(snapshots[i], expected[i]);
+}
+
+TEST(PersistentMap, Accessors) {
+  s21::persistent_map<int, std::string> s21_map = {{2, "two"}, {1, "one"}};
+  EXPECT_EQ(s21_map.at(1), "one");
+  EXPECT_THROW(s21_map.at(3), std::out_of_range);
+  EXPECT_TRUE(s21_map.contains(2));
+  EXPECT_TRUE(s21_map.find(3) == s21_map.end());
+  EXPECT_EQ(s21_map.find(2)->second, "two");
+  EXPECT_EQ(s21_map.lower_bound(0)->first, 1);
+
+  auto results = s21_map.insert_many(std::make_pair(3, "three"),
+                                     std::make_pair(1, "uno"));
+  EXPECT_TRUE(results[0]);
+  EXPECT_FALSE(results[1]);
+
+  s21::persistent_map<int, std::string> copy = s21_map;
+  copy.insert_or_assign(1, "ein");
+  EXPECT_EQ(copy.at(1), "ein");
+  EXPECT_EQ(s21_map.at(1), "one");
+}
+
+TEST(PersistentMap, ReadersOnSnapshots) {
+  s21::persistent_map<int, int> s21_map;
+  for (int key = 0; key < 2000; ++key) s21_map.insert(key, key);
+
+  // Each reader drops its snapshot at the end, while the writer keeps
+  // making new versions from the shared nodes.
+  std::vector<std::thread> readers;
+  for (int id = 0; id < 4; ++id) {
+    readers.emplace_back([snapshot = s21_map.snapshot()]() mutable {
+      long sum = 0;
+      for (const auto &item : snapshot) sum += item.second;
+      EXPECT_EQ(sum, 1999L * 2000 / 2);
+      snapshot.clear();
+    });
+  }
+  for (int key = 0; key < 2000; ++key) s21_map.erase(key);
+  for (std::thread &reader : readers) reader.join();
+  EXPECT_TRUE(s21_map.empty());
+}
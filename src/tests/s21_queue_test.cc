@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <queue>
 
 template <typename value_type>
@@ -191,3 +192,16 @@ TEST(QueueBonus, InsertManyBack) {
   my_queue1.insert_many_back(3, 4, 5);
   EXPECT_TRUE(compare_queues(my_queue1, std_queue1));
 }
+
+TEST(QueueAllocator, MonotonicBuffer) {
+  unsigned char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::queue<int> my_queue(&arena);
+  my_queue.push(1);
+  my_queue.push(2);
+
+  EXPECT_EQ(my_queue.size(), 2);
+  EXPECT_EQ(my_queue.front(), 1);
+  EXPECT_EQ(my_queue.get_allocator().resource(), &arena);
+}
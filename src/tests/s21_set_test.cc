@@ -3,7 +3,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 TEST(SetConstructors, DefaultConstructor) {
   s21::set<int> s21_set;
@@ -53,6 +61,117 @@ TEST(SetConstructors, CopyConstructor) {
   EXPECT_EQ(*(std_setcopy.find(3)), 3);
 }
 
+TEST(SetConstructors, CopyKeepsEveryElement) {
+  s21::set<int> s21_set;
+  for (int i = 0; i < 100000; ++i) s21_set.insert((i * 7919) % 100000);
+  for (int i = 0; i < 100000; i += 3) s21_set.erase(s21_set.find(i));
+
+  s21::set<int> s21_setcopy(s21_set);
+  s21_set.insert(-1);
+  s21_setcopy.erase(s21_setcopy.find(1));
+
+  EXPECT_EQ(s21_setcopy.size(), s21_set.size() - 2);
+  EXPECT_FALSE(s21_setcopy.contains(-1));
+  EXPECT_TRUE(s21_set.contains(1));
+  EXPECT_TRUE(std::equal(s21_setcopy.begin(), s21_setcopy.end(),
+                         s21_set.nth(2)));
+  EXPECT_EQ(*s21_setcopy.nth(1000), *s21_set.nth(1002));
+  EXPECT_EQ(s21_setcopy.rank(50000), s21_set.rank(50000) - 2);
+  EXPECT_EQ(*--s21_setcopy.end(), 99998);
+}
+
+TEST(SetConstructors, CopyAssignmentOperator) {
+  s21::set<std::string> s21_set = {"a", "b", "c"};
+  s21::set<std::string> s21_setcopy = {"x"};
+
+  s21_setcopy = s21_set;
+  s21_set.insert("d");
+
+  EXPECT_EQ(s21_setcopy.size(), 3);
+  EXPECT_EQ(*s21_setcopy.begin(), "a");
+  EXPECT_FALSE(s21_setcopy.contains("x"));
+  EXPECT_FALSE(s21_setcopy.contains("d"));
+}
+
+namespace {
+// Throws on the copy that brings the count to zero.
+struct CopyBudget {
+  explicit CopyBudget(int value) : value(value) {}
+  CopyBudget(const CopyBudget &other) : value(other.value) {
+    if (--budget == 0) throw std::runtime_error("copy");
+  }
+  bool operator<(const CopyBudget &other) const { return value < other.value; }
+
+  static inline int budget = -1;
+  int value;
+  std::string payload = std::string(32, 'p');
+};
+}  // namespace
+
+TEST(SetConstructors, CopyThatThrowsLeavesTarget) {
+  s21::set<CopyBudget> s21_set;
+  for (int i = 0; i < 100; ++i) s21_set.emplace(i);
+  s21::set<CopyBudget> s21_setcopy;
+  s21_setcopy.emplace(-1);
+
+  CopyBudget::budget = 50;
+  EXPECT_THROW(s21_setcopy = s21_set, std::runtime_error);
+  CopyBudget::budget = 50;
+  EXPECT_THROW(s21::set<CopyBudget>{s21_set}, std::runtime_error);
+  CopyBudget::budget = -1;
+
+  EXPECT_EQ(s21_setcopy.size(), 1);
+  EXPECT_EQ(s21_setcopy.begin()->value, -1);
+}
+
+namespace {
+// A stateful allocator that goes along with the contents on assignment.
+template <typename T>
+struct Propagating {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+
+  explicit Propagating(int id) : id(id) {}
+  template <typename U>
+  Propagating(const Propagating<U> &other) : id(other.id) {}
+
+  T *allocate(std::size_t count) { return std::allocator<T>().allocate(count); }
+  void deallocate(T *block, std::size_t count) {
+    std::allocator<T>().deallocate(block, count);
+  }
+  template <typename U>
+  bool operator==(const Propagating<U> &other) const {
+    return id == other.id;
+  }
+  template <typename U>
+  bool operator!=(const Propagating<U> &other) const {
+    return id != other.id;
+  }
+
+  int id;
+};
+}  // namespace
+
+TEST(SetConstructors, AssignmentPropagatesAllocator) {
+  using PropagatingSet = s21::set<int, std::less<int>, Propagating<int>>;
+  static_assert(std::is_nothrow_move_assignable<PropagatingSet>::value);
+  PropagatingSet s21_set({1, 2, 3}, Propagating<int>(1));
+  PropagatingSet s21_setcopy({9}, Propagating<int>(2));
+
+  s21_setcopy = s21_set;
+  EXPECT_EQ(s21_setcopy.get_allocator().id, 1);
+  EXPECT_EQ(s21_setcopy.size(), 3);
+  EXPECT_FALSE(s21_setcopy.contains(9));
+
+  PropagatingSet s21_setmove({9}, Propagating<int>(3));
+  auto first = s21_set.begin();
+  s21_setmove = std::move(s21_set);
+  EXPECT_EQ(s21_setmove.get_allocator().id, 1);
+  EXPECT_TRUE(s21_setmove.begin() == first);
+  EXPECT_TRUE(s21_set.empty());
+}
+
 TEST(SetConstructors, MoveConstructor) {
   s21::set<int> s21_set = {1, 2, 3};
   s21::set<int> s21_setmove(std::move(s21_set));
@@ -89,6 +208,24 @@ TEST(SetConstructors, MoveAssignmentOperator) {
   EXPECT_EQ(*(std_setmove.find(3)), 3);
 }
 
+TEST(SetConstructors, MoveAssignmentIntoNonEmpty) {
+  s21::set<std::string> s21_set = {"a", "b", "c"};
+  s21::set<std::string> s21_setmove = {"x", "y"};
+  auto last = --s21_set.end();
+
+  s21_setmove = std::move(s21_set);
+
+  EXPECT_EQ(s21_setmove.size(), 3);
+  EXPECT_FALSE(s21_setmove.contains("x"));
+  EXPECT_TRUE(--s21_setmove.end() == last);
+  EXPECT_TRUE(s21_set.empty());
+
+  s21_set.insert("z");
+  s21_setmove.insert("d");
+  EXPECT_EQ(s21_set.size(), 1);
+  EXPECT_EQ(*s21_setmove.nth(3), "d");
+}
+
 TEST(SetIterators, Begin) {
   s21::set<int> s21_set = {1, 2, 3};
 
@@ -115,6 +252,31 @@ TEST(SetIterators, End) {
   }
 }
 
+TEST(SetIterators, Reverse) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  EXPECT_TRUE(s21_set.rbegin() == s21_set.rend());
+
+  for (int i = 0; i < 300; ++i) {
+    int key = i * 37 % 211;
+    s21_set.insert(key);
+    std_set.insert(key);
+    if (i % 3 == 0 && std_set.erase(key / 2))
+      s21_set.erase(s21_set.find(key / 2));
+  }
+
+  EXPECT_TRUE(std::equal(s21_set.rbegin(), s21_set.rend(), std_set.rbegin(),
+                         std_set.rend()));
+  EXPECT_EQ(*--s21_set.end(), *std_set.rbegin());
+
+  auto it = s21_set.end();
+  for (size_t steps = 0; steps < s21_set.size(); ++steps) --it;
+  EXPECT_TRUE(it == s21_set.begin());
+  ++it;
+  --it;
+  EXPECT_EQ(*it, *std_set.begin());
+}
+
 TEST(SetCapacity, Empty) {
   s21::set<int> s21_set = {1, 2, 3};
 
@@ -243,4 +405,533 @@ TEST(SetLookup, Contains) {
   s21::set<int> s21_set = {1, 2, 3};
 
   EXPECT_TRUE(s21_set.contains(3));
-}
\ No newline at end of file
+}
+TEST(SetLookup, FindMissing) {
+  s21::set<int> s21_set = {1, 2, 3};
+
+  EXPECT_TRUE(s21_set.find(4) == s21_set.end());
+  EXPECT_FALSE(s21_set.contains(0));
+}
+
+TEST(SetLookup, FindBatch) {
+  // Large enough to take the interleaved path rather than plain lookups.
+  s21::set<int> s21_set;
+  for (int i = 0; i < 200000; i += 2) s21_set.insert(i);
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back((i * 7919) % 200003);
+
+  std::vector<s21::set<int>::iterator> found(keys.size(), s21_set.end());
+  auto end = s21_set.find_batch(keys.begin(), keys.end(), found.begin());
+
+  EXPECT_TRUE(end == found.end());
+  for (size_t i = 0; i < keys.size(); ++i)
+    EXPECT_TRUE(found[i] == s21_set.find(keys[i]));
+}
+
+TEST(SetLookup, ContainsBatch) {
+  s21::set<int> s21_set = {1, 2, 3};
+  int keys[] = {0, 1, 3, 4, 2};
+  std::vector<bool> present;
+
+  s21_set.contains_batch(std::begin(keys), std::end(keys),
+                         std::back_inserter(present));
+
+  EXPECT_EQ(present, std::vector<bool>({false, true, true, false, true}));
+  s21::set<int>().contains_batch(std::begin(keys), std::end(keys),
+                                 present.begin());
+  EXPECT_EQ(present, std::vector<bool>(5, false));
+}
+
+TEST(SetModifiers, EraseMany) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 7919) % 1000;
+    s21_set.insert(key);
+    std_set.insert(key);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    s21_set.erase(s21_set.find(i));
+    std_set.erase(i);
+  }
+
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it)
+    EXPECT_EQ(*it, *std_it);
+}
+
+TEST(SetLookup, NthAndRank) {
+  s21::set<int> s21_set;
+  for (int i = 0; i < 100; ++i) s21_set.insert((i * 37) % 100 * 2);
+  for (int i = 0; i < 100; i += 2) s21_set.erase(s21_set.find(i * 2));
+
+  EXPECT_EQ(s21_set.size(), 50);
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(*s21_set.nth(i), i * 4 + 2);
+    EXPECT_EQ(s21_set.rank(i * 4 + 2), i);
+    EXPECT_EQ(s21_set.rank(i * 4 + 3), i + 1);
+  }
+  EXPECT_TRUE(s21_set.nth(50) == s21_set.end());
+}
+
+TEST(SetLookup, CustomCompare) {
+  s21::set<int, std::greater<int>> s21_set = {1, 3, 2};
+  std::set<int, std::greater<int>> std_set = {1, 3, 2};
+
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it)
+    EXPECT_EQ(*it, *std_it);
+  EXPECT_TRUE(s21_set.contains(2));
+}
+
+TEST(SetLookup, TransparentFind) {
+  s21::set<std::string, std::less<>> s21_set = {"alpha", "beta", "gamma"};
+
+  EXPECT_EQ(*s21_set.find(std::string_view("beta")), "beta");
+  EXPECT_TRUE(s21_set.contains(std::string_view("gamma")));
+  EXPECT_FALSE(s21_set.contains("delta"));
+}
+
+TEST(SetAllocator, MonotonicBuffer) {
+  unsigned char buffer[16384];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::set<int> s21_set(&arena);
+
+  for (int i = 0; i < 100; ++i) s21_set.insert(i);
+  s21_set.erase(s21_set.find(50));
+
+  EXPECT_EQ(s21_set.size(), 99);
+  EXPECT_FALSE(s21_set.contains(50));
+  EXPECT_EQ(s21_set.get_allocator().resource(), &arena);
+}
+
+TEST(SetLookup, Bounds) {
+  s21::set<int> s21_set = {10, 20, 30, 40, 50};
+  std::set<int> std_set = {10, 20, 30, 40, 50};
+
+  for (int key = 5; key <= 55; key += 5) {
+    auto lower = s21_set.lower_bound(key);
+    auto upper = s21_set.upper_bound(key);
+    auto std_lower = std_set.lower_bound(key);
+    auto std_upper = std_set.upper_bound(key);
+
+    ASSERT_EQ(lower == s21_set.end(), std_lower == std_set.end());
+    if (lower != s21_set.end()) {
+      EXPECT_EQ(*lower, *std_lower);
+    }
+    ASSERT_EQ(upper == s21_set.end(), std_upper == std_set.end());
+    if (upper != s21_set.end()) {
+      EXPECT_EQ(*upper, *std_upper);
+    }
+  }
+}
+
+TEST(SetLookup, RangeScan) {
+  s21::set<int> s21_set;
+  for (int i = 0; i < 100; ++i) s21_set.insert(i);
+
+  int sum = 0;
+  for (auto it = s21_set.lower_bound(10); it != s21_set.upper_bound(19); ++it)
+    sum += *it;
+  auto range = s21_set.equal_range(42);
+
+  EXPECT_EQ(sum, 145);
+  EXPECT_EQ(*range.first, 42);
+  EXPECT_EQ(*range.second, 43);
+}
+
+TEST(SetModifiers, AssignSorted) {
+  std::vector<int> keys = {1, 2, 2, 3, 5, 8, 8, 8, 13};
+  s21::set<int> s21_set(s21::sorted_unique, keys.begin(), keys.end());
+  std::set<int> std_set(keys.begin(), keys.end());
+
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it)
+    EXPECT_EQ(*it, *std_it);
+
+  s21_set.insert(4);
+  s21_set.erase(s21_set.find(8));
+  EXPECT_EQ(*s21_set.nth(3), 4);
+  EXPECT_EQ(s21_set.rank(13), 5);
+}
+
+TEST(SetModifiers, AssignSortedRejectsUnsorted) {
+  std::vector<int> keys = {1, 3, 2};
+  s21::set<int> s21_set = {7};
+
+  EXPECT_THROW(s21_set.assign_sorted(keys.begin(), keys.end()),
+               std::invalid_argument);
+  EXPECT_TRUE(s21_set.contains(7));
+}
+
+TEST(SetModifiers, AssignParallel) {
+  std::vector<int> keys;
+  for (int i = 0; i < 100000; ++i) keys.push_back((i * 7919) % 50000);
+  s21::set<int> s21_set;
+  std::set<int> std_set(keys.begin(), keys.end());
+
+  s21_set.assign_parallel(keys.begin(), keys.end(), 4);
+
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it)
+    ASSERT_EQ(*it, *std_it);
+}
+
+TEST(SetAlgebra, MatchesStd) {
+  // The size pairs exercise both the merge walk and the per-element search.
+  for (auto sizes : {std::pair<int, int>{0, 50}, {50, 60}, {3, 4000},
+                     {4000, 3}, {500, 500}}) {
+    s21::set<int> lhs, rhs;
+    std::set<int> std_lhs, std_rhs;
+    for (int i = 0; i < sizes.first; ++i) {
+      lhs.insert(i * 3);
+      std_lhs.insert(i * 3);
+    }
+    for (int i = 0; i < sizes.second; ++i) {
+      rhs.insert(i * 2);
+      std_rhs.insert(i * 2);
+    }
+
+    auto check = [](const s21::set<int> &result, const std::vector<int> &ex) {
+      ASSERT_EQ(result.size(), ex.size());
+      auto it = result.begin();
+      for (int value : ex) {
+        EXPECT_EQ(*it, value);
+        ++it;
+      }
+    };
+    std::vector<int> expected;
+    std::set_union(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                   std_rhs.end(), std::back_inserter(expected));
+    check(s21::set_union(lhs, rhs), expected);
+
+    expected.clear();
+    std::set_intersection(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                          std_rhs.end(), std::back_inserter(expected));
+    check(s21::set_intersection(lhs, rhs), expected);
+
+    expected.clear();
+    std::set_difference(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                        std_rhs.end(), std::back_inserter(expected));
+    check(s21::set_difference(lhs, rhs), expected);
+
+    expected.clear();
+    std::set_symmetric_difference(std_lhs.begin(), std_lhs.end(),
+                                  std_rhs.begin(), std_rhs.end(),
+                                  std::back_inserter(expected));
+    check(s21::symmetric_difference(lhs, rhs), expected);
+  }
+}
+
+TEST(SetAlgebra, MergeLarge) {
+  s21::set<int> s21_set, other;
+  for (int i = 0; i < 100; ++i) s21_set.insert(i * 2);
+  for (int i = 0; i < 100; ++i) other.insert(i * 3);
+
+  s21_set.merge(other);
+
+  // Multiples of 6 were already present and stay behind, as in std::set.
+  EXPECT_EQ(other.size(), 34);
+  EXPECT_EQ(*other.nth(1), 6);
+  EXPECT_EQ(s21_set.size(), 166);
+  EXPECT_EQ(s21_set.rank(99), 66);
+  s21_set.insert(1);
+  other.insert(1);
+  EXPECT_EQ(*s21_set.nth(1), 1);
+  EXPECT_EQ(other.rank(6), 2);
+}
+
+TEST(SetNodeHandle, ExtractInsert) {
+  s21::set<int> s21_set = {1, 2, 3};
+  s21::set<int> other = {3};
+
+  s21::set<int>::node_type node = s21_set.extract(2);
+  EXPECT_FALSE(node.empty());
+  EXPECT_EQ(node.value(), 2);
+  EXPECT_EQ(s21_set.size(), 2);
+  EXPECT_TRUE(s21_set.extract(42).empty());
+
+  node.value() = 7;
+  auto result = other.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(*result.position, 7);
+  EXPECT_TRUE(result.node.empty());
+
+  result = other.insert(s21_set.extract(s21_set.find(3)));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.value(), 3);
+  EXPECT_EQ(other.size(), 2);
+}
+
+TEST(SetNodeHandle, OutlivesSource) {
+  s21::set<std::string>::node_type node;
+  {
+    s21::set<std::string> source = {"a long enough string to allocate"};
+    node = source.extract(source.begin());
+  }
+  s21::set<std::string> target;
+  target.insert(std::move(node));
+  target.erase(target.begin());
+  target.insert("reuses the freed slot");
+
+  EXPECT_EQ(*target.begin(), "reuses the freed slot");
+}
+
+TEST(SetNodeHandle, KeepsElementInPlace) {
+  s21::set<std::string> s21_set = {"a", "b", "c"};
+  const std::string *element = &*s21_set.find("b");
+
+  auto node = s21_set.extract(std::string("b"));
+  EXPECT_EQ(&node.value(), element);
+  s21_set.insert(std::move(node));
+  EXPECT_EQ(&*s21_set.find("b"), element);
+
+  s21::set<std::string> other = {"x"};
+  other.insert(s21_set.extract(std::string("b")));
+  s21_set.clear();
+  EXPECT_EQ(&*other.find("b"), element);
+  other.erase(other.find("b"));
+  for (int i = 0; i < 100; ++i) other.insert(std::to_string(i));
+  EXPECT_EQ(other.size(), 101);
+}
+
+namespace {
+// Neither copyable nor movable, which a node handle must not need.
+struct Pinned {
+  explicit Pinned(int value) : value(value) {}
+  Pinned(const Pinned &) = delete;
+  Pinned &operator=(const Pinned &) = delete;
+
+  bool operator<(const Pinned &other) const { return value < other.value; }
+
+  int value;
+};
+}  // namespace
+
+TEST(SetNodeHandle, ImmovableElements) {
+  s21::set<Pinned> s21_set;
+  for (int i = 0; i < 10; ++i) s21_set.emplace(i);
+  s21::set<Pinned> other;
+
+  auto result = other.insert(s21_set.extract(s21_set.begin()));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(result.position->value, 0);
+  EXPECT_EQ(s21_set.begin()->value, 1);
+}
+
+TEST(SetNodeHandle, MergeAcrossResources) {
+  std::pmr::unsynchronized_pool_resource first, second;
+  s21::pmr::set<int> s21_set({1, 2}, &first);
+  s21::pmr::set<int> other({2, 3}, &second);
+
+  s21_set.merge(other);
+
+  EXPECT_EQ(s21_set.size(), 3);
+  EXPECT_EQ(other.size(), 1);
+  EXPECT_EQ(*other.begin(), 2);
+}
+
+TEST(SetModifiers, InsertWithHint) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+
+  // Ascending keys at end(), descending keys at the previous result, and
+  // hints that point somewhere else entirely.
+  for (int i = 0; i < 100; ++i) s21_set.insert(s21_set.end(), i * 3);
+  auto hint = s21_set.begin();
+  for (int i = -1; i > -50; --i) hint = s21_set.insert(hint, i);
+  for (int i = 0; i < 300; i += 7) s21_set.insert(s21_set.find(150), i);
+  for (int i = 0; i < 100; ++i) std_set.insert(i * 3);
+  for (int i = -1; i > -50; --i) std_set.insert(i);
+  for (int i = 0; i < 300; i += 7) std_set.insert(i);
+
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it)
+    ASSERT_EQ(*it, *std_it);
+  EXPECT_EQ(*s21_set.insert(s21_set.begin(), 42), 42);
+  EXPECT_EQ(*s21_set.emplace_hint(s21_set.end(), 1000), 1000);
+  EXPECT_EQ(s21_set.rank(1000), std_set.size());
+}
+
+TEST(SetModifiers, Emplace) {
+  s21::set<std::string> s21_set;
+
+  auto [it, inserted] = s21_set.emplace(3, 'x');
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(*it, "xxx");
+  EXPECT_FALSE(s21_set.emplace("xxx").second);
+  EXPECT_TRUE(s21_set.insert(std::string("y")).second);
+  EXPECT_EQ(s21_set.size(), 2);
+}
+
+using CompactSet =
+    s21::set<int, std::less<int>, std::allocator<int>, s21::compact_layout>;
+
+TEST(SetLayout, CompactMatchesStd) {
+  CompactSet s21_set;
+  std::set<int> std_set;
+
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 1000;
+    if (i % 3 == 2) {
+      s21_set.erase(s21_set.find(key));
+      std_set.erase(key);
+    } else {
+      s21_set.insert(key);
+      std_set.insert(key);
+    }
+  }
+
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                         std_set.end()));
+  EXPECT_TRUE(std::equal(s21_set.rbegin(), s21_set.rend(), std_set.rbegin(),
+                         std_set.rend()));
+}
+
+TEST(SetLayout, CompactCopyMergeAndAlgebra) {
+  std::vector<int> evens, odds;
+  for (int i = 0; i < 200; ++i) (i % 2 ? odds : evens).push_back(i);
+  CompactSet lhs(s21::sorted_unique, evens.begin(), evens.end());
+  CompactSet rhs = {1, 2, 3};
+
+  CompactSet copy(lhs);
+  CompactSet moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ(s21::set_union(lhs, rhs).size(), 102);
+  EXPECT_EQ(s21::set_intersection(lhs, rhs).size(), 1);
+
+  CompactSet other(s21::sorted_unique, odds.begin(), odds.end());
+  moved.merge(other);
+  EXPECT_EQ(moved.size(), 200);
+  EXPECT_TRUE(other.empty());
+  auto node = moved.extract(moved.find(7));
+  EXPECT_TRUE(other.insert(std::move(node)).inserted);
+  EXPECT_EQ(moved.size(), 199);
+  EXPECT_EQ(other.size(), 1);
+}
+
+template <typename Key>
+using ArenaSet =
+    s21::set<Key, std::less<Key>, std::allocator<Key>, s21::arena_layout>;
+
+TEST(SetLayout, ArenaMatchesStd) {
+  ArenaSet<std::string> s21_set;
+  std::set<std::string> std_set;
+
+  for (int i = 0; i < 3000; ++i) {
+    std::string key = std::to_string((i * 7919) % 1000);
+    if (i % 3 == 2) {
+      s21_set.erase(s21_set.find(key));
+      std_set.erase(key);
+    } else {
+      s21_set.insert(key);
+      std_set.insert(key);
+    }
+  }
+
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                         std_set.end()));
+  EXPECT_TRUE(std::equal(s21_set.rbegin(), s21_set.rend(), std_set.rbegin(),
+                         std_set.rend()));
+}
+
+TEST(SetLayout, ArenaCopyMergeAndHandles) {
+  std::vector<int> evens, odds;
+  for (int i = 0; i < 200; ++i) (i % 2 ? odds : evens).push_back(i);
+  ArenaSet<int> lhs(s21::sorted_unique, evens.begin(), evens.end());
+  ArenaSet<int> rhs = {1, 2, 3};
+
+  ArenaSet<int> copy(lhs);
+  copy.insert(-1);
+  ArenaSet<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 101);
+  EXPECT_EQ(lhs.size(), 100);
+  EXPECT_EQ(s21::set_union(lhs, rhs).size(), 102);
+  moved.swap(rhs);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_EQ(*rhs.begin(), -1);
+
+  ArenaSet<int> other(s21::sorted_unique, odds.begin(), odds.end());
+  lhs.merge(other);
+  EXPECT_EQ(lhs.size(), 200);
+  EXPECT_TRUE(other.empty());
+  auto node = lhs.extract(lhs.find(7));
+  EXPECT_TRUE(other.insert(std::move(node)).inserted);
+  EXPECT_EQ(lhs.size(), 199);
+  EXPECT_EQ(*other.begin(), 7);
+
+  ArenaSet<std::string> words = {"b", "a", "c"};
+  ArenaSet<std::string> words_copy(words);
+  words.insert(*words.begin());
+  EXPECT_EQ(words.size(), 3);
+  EXPECT_TRUE(std::equal(words.begin(), words.end(), words_copy.begin(),
+                         words_copy.end()));
+}
+
+TEST(SetLayout, ArenaReserveKeepsIterators) {
+  ArenaSet<int> s21_set;
+  s21_set.reserve(1000);
+  auto first = s21_set.insert(500).first;
+
+  for (int i = 0; i < 999; ++i) s21_set.insert(i < 500 ? i : i + 1);
+  EXPECT_EQ(s21_set.size(), 1000);
+  EXPECT_EQ(*first, 500);
+  EXPECT_EQ(*std::prev(first), 499);
+  EXPECT_EQ(*std::next(first), 501);
+}
+
+using CountingSet = s21::set<int, std::less<int>, std::allocator<int>,
+                             s21::ranked_layout, s21::counting_stats>;
+
+TEST(SetStats, CountsRebalancing) {
+  CountingSet s21_set;
+  EXPECT_EQ(s21_set.height(), 0);
+
+  s21_set.insert(1);
+  s21_set.insert(2);
+  s21_set.insert(3);
+  s21::tree_stats stats = s21_set.stats();
+  EXPECT_EQ(stats.left_rotations, 1);
+  EXPECT_EQ(stats.right_rotations, 0);
+  EXPECT_EQ(stats.insert_fixups, 1);
+  EXPECT_EQ(stats.allocations, 3);
+  EXPECT_EQ(stats.comparisons, 8);
+  EXPECT_EQ(s21_set.height(), 2);
+
+  s21_set.insert(0);
+  s21_set.erase(s21_set.find(0));
+  s21_set.erase(s21_set.find(1));
+  stats = s21_set.stats();
+  EXPECT_EQ(stats.allocations, 4);
+  EXPECT_EQ(stats.delete_fixups, 1);
+  EXPECT_EQ(s21_set.height(), 2);
+}
+
+TEST(SetStats, HeightOfLargerTrees) {
+  std::vector<int> keys(127);
+  for (int i = 0; i < 127; ++i) keys[i] = i;
+  CountingSet balanced(s21::sorted_unique, keys.begin(), keys.end());
+  EXPECT_EQ(balanced.height(), 7);
+  EXPECT_EQ(balanced.stats().left_rotations, 0);
+
+  CountingSet ascending;
+  for (int key : keys) ascending.insert(key);
+  s21::tree_stats stats = ascending.stats();
+  EXPECT_GE(ascending.height(), 7);
+  EXPECT_LE(ascending.height(), 14);
+  EXPECT_GT(stats.left_rotations, 0);
+  EXPECT_EQ(stats.right_rotations, 0);
+
+  CountingSet copy(ascending);
+  EXPECT_EQ(copy.height(), ascending.height());
+  EXPECT_EQ(copy.stats().comparisons, 0);
+}
@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <stack>
 
 TEST(StackConstructors, DefaultConstructor) {
@@ -248,4 +249,16 @@ TEST(StackBonus, InsertManyFront) {
   my_stack.pop();
   my_stack.pop();
   EXPECT_TRUE(my_stack.empty());
-}
\ No newline at end of file
+}
+TEST(StackAllocator, MonotonicBuffer) {
+  unsigned char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::stack<int> s21_stack(&arena);
+  s21_stack.push(1);
+  s21_stack.push(2);
+
+  EXPECT_EQ(s21_stack.size(), 2);
+  EXPECT_EQ(s21_stack.top(), 2);
+  EXPECT_EQ(s21_stack.get_allocator().resource(), &arena);
+}
@@ -0,0 +1,96 @@
+#include "../s21_containers/s21_static_map.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containers/s21_map.h"
+
+TEST(StaticMap, FreezeAnswersLikeTheMap) {
+  s21::map<int, std::string> s21_map;
+  for (int i = 0; i < 5000; ++i)
+    s21_map.insert(i * 7919 % 10007 * 3, std::to_string(i));
+  s21::static_map<int, std::string> frozen = s21_map.freeze();
+
+  EXPECT_EQ(frozen.size(), s21_map.size());
+  auto it = s21_map.begin();
+  for (auto pair : frozen) {
+    EXPECT_EQ(pair.first, (*it).first);
+    EXPECT_EQ(pair.second, (*it).second);
+    ++it;
+  }
+  for (int key = -2; key < 30030; key += 5) {
+    EXPECT_EQ(frozen.contains(key), s21_map.contains(key));
+    if (s21_map.contains(key)) {
+      EXPECT_EQ(frozen.at(key), s21_map.at(key));
+    }
+    auto lower = s21_map.lower_bound(key);
+    if (lower != s21_map.end()) {
+      EXPECT_EQ(frozen.lower_bound(key)->first, (*lower).first);
+    }
+  }
+  EXPECT_THROW(frozen.at(1), std::out_of_range);
+}
+
+TEST(StaticMap, BuildsFromRange) {
+  std::vector<std::pair<std::string, int>> items = {
+      {"b", 2}, {"a", 1}, {"c", 3}, {"a", 10}};
+  s21::static_map<std::string, int, std::less<>> s21_map(items.begin(),
+                                                         items.end());
+
+  EXPECT_EQ(s21_map.size(), 3);
+  EXPECT_EQ(s21_map.at("a"), 1);
+  EXPECT_EQ(s21_map.at(std::string_view("c")), 3);
+  EXPECT_EQ(s21_map.keys()[1], "b");
+  EXPECT_EQ(s21_map.values()[2], 3);
+  EXPECT_EQ((*s21_map.rbegin()).first, "c");
+  EXPECT_EQ(s21_map.end() - s21_map.begin(), 3);
+
+  auto [first, last] = s21_map.equal_range("z");
+  EXPECT_EQ(first, last);
+  EXPECT_EQ(s21_map.upper_bound("a")->first, "b");
+}
+
+TEST(StaticMap, SortedInput) {
+  using IntMap = s21::static_map<int, int>;
+  std::map<int, int> std_map = {{1, 1}, {2, 4}, {3, 9}};
+  IntMap s21_map(s21::sorted_unique, std_map.begin(), std_map.end());
+  EXPECT_EQ(s21_map.at(3), 9);
+
+  std::vector<std::pair<int, int>> unsorted = {{2, 4}, {1, 1}};
+  EXPECT_THROW(IntMap(s21::sorted_unique, unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+
+  IntMap moved = std::move(s21_map);
+  EXPECT_TRUE(moved.contains(2));
+  EXPECT_TRUE(s21_map.empty());
+}
+
+TEST(StaticMap, Assignment) {
+  static_assert(
+      std::is_nothrow_move_assignable<s21::static_map<int, int>>::value);
+  static_assert(
+      !std::is_nothrow_move_assignable<s21::pmr::static_map<int, int>>::value);
+
+  s21::static_map<int, std::string> s21_map = {{2, "two"}, {1, "one"}};
+  s21::static_map<int, std::string> copy = {{9, "nine"}};
+  copy = s21_map;
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.at(2), "two");
+  EXPECT_FALSE(copy.contains(9));
+
+  s21::pmr::static_map<int, int> source = {{1, 1}, {2, 4}};
+  s21::pmr::static_map<int, int> target(std::less<int>(),
+                                        std::pmr::null_memory_resource());
+  EXPECT_THROW(target = std::move(source), std::bad_alloc);
+  EXPECT_TRUE(target.empty());
+  EXPECT_EQ(target.find(1), target.end());
+}
@@ -0,0 +1,118 @@
+#include "../s21_containers/s21_static_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containers/s21_set.h"
+
+TEST(StaticSet, FreezeAnswersLikeTheSet) {
+  for (int count : {0, 1, 15, 16, 17, 100, 1000, 20000}) {
+    s21::set<int> s21_set;
+    for (int i = 0; i < count; ++i) s21_set.insert(i * 7919 % 50021 * 2);
+    s21::static_set<int> frozen = s21_set.freeze();
+
+    EXPECT_EQ(frozen.size(), s21_set.size());
+    EXPECT_TRUE(std::equal(frozen.begin(), frozen.end(), s21_set.begin(),
+                           s21_set.end()));
+    for (int key = -3; key < 100050; key += 7) {
+      auto lower = s21_set.lower_bound(key);
+      if (lower == s21_set.end()) {
+        EXPECT_EQ(frozen.lower_bound(key), frozen.end());
+      } else {
+        EXPECT_EQ(*frozen.lower_bound(key), *lower);
+      }
+      EXPECT_EQ(frozen.upper_bound(key) - frozen.begin(),
+                static_cast<std::ptrdiff_t>(s21_set.rank(key + 1)));
+      EXPECT_EQ(frozen.contains(key), s21_set.contains(key));
+      EXPECT_EQ(frozen.find(key) != frozen.end(), s21_set.contains(key));
+    }
+  }
+}
+
+TEST(StaticSet, BuildsSortedAndUnique) {
+  std::vector<int> keys;
+  for (int i = 0; i < 2000; ++i) keys.push_back(i * 7919 % 1000);
+
+  s21::static_set<int> s21_set(keys.begin(), keys.end());
+  std::set<int> std_set(keys.begin(), keys.end());
+  EXPECT_EQ(s21_set.size(), 1000);
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                         std_set.end()));
+  EXPECT_TRUE(std::equal(s21_set.rbegin(), s21_set.rend(), std_set.rbegin(),
+                         std_set.rend()));
+
+  auto [first, last] = s21_set.equal_range(500);
+  EXPECT_EQ(last - first, 1);
+  EXPECT_EQ(*first, 500);
+}
+
+TEST(StaticSet, SortedInput) {
+  std::vector<int> sorted = {1, 4, 9};
+  s21::static_set<int> s21_set(s21::sorted_unique, sorted.begin(),
+                               sorted.end());
+  EXPECT_TRUE(s21_set.contains(9));
+  EXPECT_FALSE(s21_set.contains(5));
+
+  std::vector<int> unsorted = {1, 9, 4};
+  EXPECT_THROW(s21::static_set<int>(s21::sorted_unique, unsorted.begin(),
+                                    unsorted.end()),
+               std::invalid_argument);
+}
+
+TEST(StaticSet, OtherKeysAndOrders) {
+  s21::static_set<std::string, std::less<>> strings = {"kiwi", "apple",
+                                                       "fig", "apple"};
+  EXPECT_EQ(strings.size(), 3);
+  EXPECT_EQ(*strings.begin(), "apple");
+  EXPECT_TRUE(strings.contains(std::string_view("fig")));
+  EXPECT_EQ(*strings.lower_bound(std::string_view("g")), "kiwi");
+
+  s21::static_set<int, std::greater<int>> descending = {1, 5, 3, 9, 7};
+  EXPECT_EQ(*descending.begin(), 9);
+  EXPECT_EQ(*descending.lower_bound(6), 5);
+  EXPECT_EQ(descending.upper_bound(0), descending.end());
+}
+
+TEST(StaticSet, FreezeKeepsResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::set<long> s21_set(&arena);
+  for (long i = 0; i < 100; ++i) s21_set.insert(i * i);
+
+  s21::pmr::static_set<long> frozen = s21_set.freeze();
+  s21_set.clear();
+
+  EXPECT_EQ(frozen.get_allocator().resource(), &arena);
+  EXPECT_EQ(frozen.size(), 100);
+  EXPECT_TRUE(frozen.contains(81 * 81));
+  EXPECT_FALSE(frozen.contains(82));
+}
+
+TEST(StaticSet, Assignment) {
+  static_assert(std::is_nothrow_move_assignable<s21::static_set<int>>::value);
+  static_assert(
+      !std::is_nothrow_move_assignable<s21::pmr::static_set<int>>::value);
+
+  s21::static_set<int> s21_set = {5, 1, 3};
+  s21::static_set<int> copy = {9};
+  copy = s21_set;
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_TRUE(copy.contains(5));
+  EXPECT_FALSE(copy.contains(9));
+
+  s21::pmr::static_set<int> source = {1, 2, 3};
+  s21::pmr::static_set<int> target(std::less<int>(),
+                                   std::pmr::null_memory_resource());
+  EXPECT_THROW(target = std::move(source), std::bad_alloc);
+  EXPECT_TRUE(target.empty());
+  EXPECT_FALSE(target.contains(1));
+}
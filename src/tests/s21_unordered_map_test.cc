@@ -0,0 +1,216 @@
+#include "../s21_containers/s21_unordered_map.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// Sends every key to one of a few slots, so runs grow long, wrap around the
+// end of the table and have to be shifted back on every erase.
+struct FewSlots {
+  std::size_t operator()(int key) const noexcept {
+    return static_cast<std::size_t>(key % 5);
+  }
+};
+
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view key) const noexcept {
+    return std::hash<std::string_view>()(key);
+  }
+};
+
+// Counts the blocks still allocated from it, to tell which resource a
+// container returns its memory to.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  long live = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    ++live;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+
+  void do_deallocate(void *block, std::size_t bytes,
+                     std::size_t align) override {
+    --live;
+    std::pmr::new_delete_resource()->deallocate(block, bytes, align);
+  }
+
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+TEST(UnorderedMap, MatchesStdUnderChurn) {
+  s21::unordered_map<int, std::string> s21_map;
+  std::unordered_map<int, std::string> std_map;
+  std::mt19937 rng(15);
+
+  for (int i = 0; i < 60000; ++i) {
+    int key = static_cast<int>(rng() % 6000);
+    if (rng() % 3) {
+      s21_map.insert_or_assign(key, std::to_string(i));
+      std_map.insert_or_assign(key, std::to_string(i));
+    } else {
+      ASSERT_EQ(s21_map.erase(key), std_map.erase(key));
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  std::size_t visited = 0;
+  for (const auto &item : s21_map) {
+    auto it = std_map.find(item.first);
+    ASSERT_NE(it, std_map.end());
+    EXPECT_EQ(item.second, it->second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, std_map.size());
+  EXPECT_LE(s21_map.load_factor(), s21_map.max_load_factor());
+}
+
+TEST(UnorderedMap, CollidingHashes) {
+  s21::unordered_map<int, int, FewSlots> s21_map;
+  std::map<int, int> std_map;
+  std::mt19937 rng(5);
+
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(rng() % 400);
+    if (rng() % 2) {
+      EXPECT_EQ(s21_map.insert(key, i).second,
+                std_map.insert({key, i}).second);
+    } else {
+      auto it = s21_map.find(key);
+      ASSERT_EQ(it != s21_map.end(), std_map.erase(key) == 1);
+      if (it != s21_map.end()) s21_map.erase(it);
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  for (const auto &item : std_map)
+    EXPECT_EQ(s21_map.at(item.first), item.second);
+  for (int key = 0; key < 400; ++key)
+    EXPECT_EQ(s21_map.contains(key), std_map.count(key) == 1);
+}
+
+TEST(UnorderedMap, Accessors) {
+  s21::unordered_map<int, std::string> s21_map = {{2, "two"}, {1, "one"}};
+
+  EXPECT_EQ(s21_map.at(1), "one");
+  EXPECT_THROW(s21_map.at(3), std::out_of_range);
+  s21_map[3] = "three";
+  EXPECT_EQ(s21_map[3], "three");
+  EXPECT_EQ(s21_map[4], "");
+
+  EXPECT_FALSE(s21_map.insert(1, "uno").second);
+  EXPECT_FALSE(s21_map.try_emplace(2, "dos").second);
+  EXPECT_TRUE(s21_map.try_emplace(5, 3, 'x').second);
+  EXPECT_EQ(s21_map.at(5), "xxx");
+  EXPECT_TRUE(s21_map.emplace(6, "six").second);
+  EXPECT_EQ(s21_map.size(), 6);
+
+  auto results = s21_map.insert_many(std::make_pair(7, "seven"),
+                                     std::make_pair(1, "ein"));
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_EQ(s21_map.at(1), "one");
+}
+
+TEST(UnorderedMap, CopyMoveAndTransparentLookup) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> s21_map;
+  for (int i = 0; i < 1000; ++i) s21_map["key-" + std::to_string(i)] = i;
+
+  auto copy(s21_map);
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(copy.at(std::string_view("key-500")), 500);
+  EXPECT_FALSE(copy.contains(std::string_view("key-1000")));
+
+  decltype(s21_map) assigned;
+  assigned["gone"] = -1;
+  assigned = s21_map;
+  EXPECT_EQ(assigned.size(), 1000);
+  EXPECT_EQ(assigned.at(std::string_view("key-999")), 999);
+  EXPECT_FALSE(assigned.contains(std::string_view("gone")));
+
+  auto moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 1000);
+  moved.clear();
+  EXPECT_TRUE(moved.begin() == moved.end());
+  EXPECT_EQ(s21_map.size(), 1000);
+}
+
+TEST(UnorderedMap, MonotonicBuffer) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::unordered_map<int, int> s21_map(&resource);
+  s21_map.reserve(3000);
+  std::size_t buckets = s21_map.bucket_count();
+  for (int i = 0; i < 3000; ++i) s21_map.insert(i, -i);
+
+  EXPECT_EQ(s21_map.bucket_count(), buckets);
+  EXPECT_EQ(s21_map.at(2999), -2999);
+  EXPECT_EQ(s21_map.get_allocator().resource(), &resource);
+}
+
+TEST(UnorderedMap, CopyAssignmentKeepsResource) {
+  CountingResource source_arena;
+  CountingResource target_arena;
+  {
+    s21::pmr::unordered_map<int, std::string> source(&source_arena);
+    for (int i = 0; i < 1000; ++i) source.insert(i, std::to_string(i));
+    long blocks = source_arena.live;
+
+    s21::pmr::unordered_map<int, std::string> target(&target_arena);
+    target.insert(-1, "gone");
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &target_arena);
+    EXPECT_EQ(target.size(), 1000);
+    EXPECT_FALSE(target.contains(-1));
+    EXPECT_EQ(target.at(500), "500");
+    EXPECT_EQ(source_arena.live, blocks);
+  }
+  EXPECT_EQ(source_arena.live, 0);
+  EXPECT_EQ(target_arena.live, 0);
+}
+
+TEST(UnorderedMap, MoveKeepsResource) {
+  CountingResource arena;
+  CountingResource fallback;
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(&fallback);
+  {
+    s21::pmr::unordered_map<int, std::string> s21_map(&arena);
+    for (int i = 0; i < 100; ++i) s21_map.insert(i, std::string(40, 'x'));
+    long blocks = arena.live;
+
+    s21::pmr::unordered_map<int, std::string> moved(std::move(s21_map));
+    EXPECT_EQ(moved.get_allocator().resource(), &arena);
+    EXPECT_EQ(moved.at(99), std::string(40, 'x'));
+    EXPECT_EQ(arena.live, blocks);
+
+    s21::pmr::unordered_map<int, std::string> other;
+    other.insert(1, "one");
+    other = std::move(moved);
+    EXPECT_EQ(other.get_allocator().resource(), &fallback);
+    EXPECT_EQ(other.size(), 100);
+    EXPECT_EQ(other.at(50), std::string(40, 'x'));
+    EXPECT_TRUE(moved.empty());
+
+    s21::pmr::unordered_map<int, std::string> same(&arena);
+    same = std::move(other);
+    EXPECT_EQ(same.size(), 100);
+    EXPECT_TRUE(other.empty());
+  }
+  std::pmr::set_default_resource(previous);
+  EXPECT_EQ(arena.live, 0);
+  EXPECT_EQ(fallback.live, 0);
+}
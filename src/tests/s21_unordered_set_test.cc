@@ -0,0 +1,76 @@
+#include "../s21_containers/s21_unordered_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+TEST(UnorderedSet, MatchesStdUnderChurn) {
+  s21::unordered_set<int> s21_set;
+  std::unordered_set<int> std_set;
+  std::mt19937 rng(51);
+
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 20000; ++i) {
+      int key = static_cast<int>(rng() % 30000);
+      EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+    }
+    for (int i = 0; i < 25000; ++i) {
+      int key = static_cast<int>(rng() % 30000);
+      ASSERT_EQ(s21_set.erase(key), std_set.erase(key));
+    }
+    ASSERT_EQ(s21_set.size(), std_set.size());
+    std::vector<int> keys(s21_set.begin(), s21_set.end());
+    std::sort(keys.begin(), keys.end());
+    std::set<int> expected(std_set.begin(), std_set.end());
+    EXPECT_TRUE(
+        std::equal(keys.begin(), keys.end(), expected.begin(), expected.end()));
+  }
+
+  while (!s21_set.empty()) s21_set.erase(s21_set.begin());
+  EXPECT_TRUE(s21_set.begin() == s21_set.end());
+}
+
+TEST(UnorderedSet, Basics) {
+  s21::unordered_set<std::string> s21_set = {"a", "b", "c", "a"};
+  EXPECT_EQ(s21_set.size(), 3);
+  EXPECT_TRUE(s21_set.contains("b"));
+  EXPECT_FALSE(s21_set.contains("d"));
+  EXPECT_EQ(*s21_set.find("c"), "c");
+  EXPECT_TRUE(s21_set.find("d") == s21_set.end());
+
+  auto results = s21_set.insert_many("d", "a");
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_TRUE(s21_set.emplace(3, 'e').second);
+  EXPECT_TRUE(s21_set.contains("eee"));
+
+  s21::unordered_set<std::string> other;
+  other.swap(s21_set);
+  EXPECT_TRUE(s21_set.empty());
+  EXPECT_EQ(other.size(), 5);
+}
+
+TEST(UnorderedSet, EmptyTable) {
+  s21::unordered_set<int> s21_set;
+  EXPECT_TRUE(s21_set.begin() == s21_set.end());
+  EXPECT_FALSE(s21_set.contains(1));
+  EXPECT_EQ(s21_set.erase(1), 0);
+  EXPECT_EQ(s21_set.bucket_count(), 0);
+  EXPECT_EQ(s21_set.load_factor(), 0.0f);
+
+  s21::unordered_set<int> copy(s21_set);
+  EXPECT_TRUE(copy.empty());
+
+  s21::unordered_set<int> assigned = {1, 2, 3};
+  assigned = s21_set;
+  EXPECT_TRUE(assigned.empty());
+  assigned.insert(4);
+  copy = assigned;
+  EXPECT_TRUE(copy.contains(4));
+  EXPECT_EQ(copy.size(), 1);
+}
@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <vector>
 
 TEST(VectorConstructors, DefaultConstructor) {
@@ -99,6 +100,17 @@ TEST(VectorConstructors, MoveAssignmentOperator) {
   }
 }
 
+TEST(VectorConstructors, CopyAssignmentOperator) {
+  s21::vector<int> s21_vector_1 = {1, 2, 3};
+  s21::vector<int> s21_vector_2 = {4, 5, 6, 7, 8};
+  s21_vector_2 = s21_vector_1;
+  s21_vector_1.push_back(4);
+
+  ASSERT_EQ(s21_vector_2.size(), 3);
+  EXPECT_EQ(s21_vector_2.at(0), 1);
+  EXPECT_EQ(s21_vector_2.at(2), 3);
+}
+
 TEST(VectorElementAccess, At) {
   s21::vector<int> s21_v = {1, 2, 3, 4, 5};
   std::vector<int> std_v = {1, 2, 3, 4, 5};
@@ -331,3 +343,18 @@ TEST(VectorBonus, InsertManyBack) {
   EXPECT_EQ(my_vec.front(), std_vec.front());
   EXPECT_EQ(my_vec.back(), std_vec.back());
 }
+
+TEST(VectorAllocator, MonotonicBuffer) {
+  unsigned char buffer[1024];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::vector<int> s21_v(&arena);
+
+  for (int i = 0; i < 100; ++i) s21_v.push_back(i);
+  s21_v.insert(s21_v.begin(), -1);
+
+  EXPECT_EQ(s21_v.size(), 101);
+  EXPECT_EQ(s21_v.at(0), -1);
+  EXPECT_EQ(s21_v.at(100), 99);
+  EXPECT_EQ(s21_v.get_allocator().resource(), &arena);
+}